@@ -0,0 +1,57 @@
+#pragma once
+
+#include <Ignis/Engine.hpp>
+
+namespace Ignis {
+    class Cooker {
+       public:
+        // Bump whenever a cook recipe changes its output, every asset is cooked again then.
+        static constexpr uint32_t k_Version = 1;
+
+        static constexpr std::array<std::string_view, 5> k_ModelExtensions{".gltf", ".glb", ".obj", ".fbx", ".dae"};
+        static constexpr std::array<std::string_view, 1> k_EnvironmentExtensions{".hdr"};
+
+        struct Settings {
+            std::filesystem::path RootDirectory{};
+            std::filesystem::path CacheDirectory{};
+
+            // Cooks every asset, current or not.
+            bool Force = false;
+        };
+
+        struct Statistics {
+            uint32_t CookedCount  = 0;
+            uint32_t CurrentCount = 0;
+            uint32_t FailedCount  = 0;
+            uint32_t RemovedCount = 0;
+        };
+
+       public:
+        explicit Cooker(const Settings &settings);
+        ~Cooker() = default;
+
+        // Cooks what changed since the last run and drops what no longer has a source.
+        bool run();
+
+        const Statistics &getStatistics() const;
+
+       private:
+        void cookModel(const std::filesystem::path &path);
+        void cookTexture(const std::filesystem::path &path, Render::TextureRole role);
+        void cookEnvironment(const std::filesystem::path &path);
+
+        // Marks the key as visited and tells whether its cooked file can be kept.
+        bool visit(const std::string &key);
+
+        // The recipe names how the dependencies are turned into the cooked file.
+        AssetDatabase::Entry makeEntry(std::string_view recipe, std::string_view extension, std::vector<AssetDatabase::Dependency> &&dependencies) const;
+
+       private:
+        Settings   m_Settings;
+        Statistics m_Statistics;
+
+        std::optional<AssetDatabase> m_AssetDatabase;
+
+        gtl::flat_hash_set<std::string> m_VisitedKeys;
+    };
+}  // namespace Ignis
@@ -0,0 +1,258 @@
+#include <Ignis/Cooker.hpp>
+
+namespace Ignis {
+    std::string GetLowercaseExtension(const std::filesystem::path &path);
+
+    Cooker::Cooker(const Settings &settings)
+        : m_Settings{settings},
+          m_Statistics{},
+          m_AssetDatabase{std::nullopt},
+          m_VisitedKeys{} {
+    }
+
+    bool Cooker::run() {
+        m_Statistics = Statistics{};
+        m_VisitedKeys.clear();
+
+        m_AssetDatabase = AssetDatabase::Open(m_Settings.RootDirectory, m_Settings.CacheDirectory);
+        if (!m_AssetDatabase.has_value())
+            return false;
+
+        const std::string cache_directory = std::filesystem::weakly_canonical(m_Settings.CacheDirectory).string();
+
+        std::error_code error{};
+        for (const std::filesystem::directory_entry &directory_entry :
+             std::filesystem::recursive_directory_iterator{
+                 m_Settings.RootDirectory,
+                 std::filesystem::directory_options::skip_permission_denied,
+                 error}) {
+            if (!directory_entry.is_regular_file())
+                continue;
+
+            const std::filesystem::path &path = directory_entry.path();
+
+            // The cache may live under the root, its files are outputs and never sources.
+            if (std::filesystem::weakly_canonical(path).string().starts_with(cache_directory))
+                continue;
+
+            const std::string extension = GetLowercaseExtension(path);
+
+            if (std::end(k_ModelExtensions) != std::ranges::find(k_ModelExtensions, extension))
+                cookModel(path);
+            else if (std::end(k_EnvironmentExtensions) != std::ranges::find(k_EnvironmentExtensions, extension))
+                cookEnvironment(path);
+        }
+
+        if (error) {
+            IGNIS_LOG_APPLICATION_ERROR("Failed to scan the asset root: '{}'. Error: '{}'", m_Settings.RootDirectory.string(), error.message());
+            return false;
+        }
+
+        // Entries nothing asked for belong to deleted sources or to textures no material reads anymore.
+        std::vector<std::string> stale_keys{};
+        for (const std::string &key : std::views::keys(m_AssetDatabase->getEntries()))
+            if (!m_VisitedKeys.contains(key))
+                stale_keys.push_back(key);
+
+        for (const std::string &key : stale_keys)
+            m_AssetDatabase->removeEntry(key);
+
+        m_Statistics.RemovedCount = m_AssetDatabase->removeUnreferenced();
+
+        const bool saved = m_AssetDatabase->save();
+
+        IGNIS_LOG_APPLICATION_INFO(
+            "Cooked {} assets, {} current, {} failed, {} cooked files removed",
+            m_Statistics.CookedCount,
+            m_Statistics.CurrentCount,
+            m_Statistics.FailedCount,
+            m_Statistics.RemovedCount);
+
+        return saved && 0 == m_Statistics.FailedCount;
+    }
+
+    const Cooker::Statistics &Cooker::getStatistics() const {
+        return m_Statistics;
+    }
+
+    void Cooker::cookModel(const std::filesystem::path &path) {
+        const std::string key = m_AssetDatabase->getKey(path);
+
+        std::optional<Render::CookedModel> cooked_model = std::nullopt;
+
+        // A current model is still loaded, its materials list the textures to visit.
+        if (visit(key))
+            cooked_model = Render::LoadCookedModel(m_AssetDatabase->getCookedPath(*m_AssetDatabase->findEntry(key)));
+
+        if (!cooked_model.has_value()) {
+            IGNIS_LOG_APPLICATION_INFO("Cooking model: '{}'", key);
+
+            cooked_model = Render::ImportModel(path);
+            if (!cooked_model.has_value()) {
+                IGNIS_LOG_APPLICATION_ERROR("Failed to import model: '{}'", key);
+                m_Statistics.FailedCount++;
+                return;
+            }
+
+            std::vector<AssetDatabase::Dependency> dependencies{};
+            for (const std::filesystem::path &source_file : cooked_model->SourceFiles) {
+                std::optional<AssetDatabase::Dependency> dependency = m_AssetDatabase->getDependency(source_file);
+                if (!dependency.has_value()) {
+                    m_Statistics.FailedCount++;
+                    return;
+                }
+
+                dependencies.push_back(std::move(dependency.value()));
+            }
+
+            const AssetDatabase::Entry entry = makeEntry(
+                FormatString("Model/{}", Render::k_CookedModelVersion),
+                Render::k_CookedModelExtension,
+                std::move(dependencies));
+
+            if (!Render::SaveCookedModel(cooked_model.value(), m_AssetDatabase->getCookedPath(entry))) {
+                m_Statistics.FailedCount++;
+                return;
+            }
+
+            m_AssetDatabase->setEntry(key, entry);
+            m_Statistics.CookedCount++;
+        }
+
+        const std::filesystem::path directory = path.parent_path();
+
+        // Embedded textures travel inside the cooked model, containers are already in their final format.
+        for (const Render::CookedMaterial &material : cooked_model->Materials) {
+            for (uint32_t role = 0; role < Render::k_TextureRoleCount; role++) {
+                const uint32_t texture_index = material.Textures[role];
+                if (Render::k_InvalidCookedTexture == texture_index)
+                    continue;
+
+                const Render::CookedTexture &texture = cooked_model->Textures[texture_index];
+                if (!texture.EmbeddedData.empty() || ".ktx2" == texture.Extension || ".dds" == texture.Extension)
+                    continue;
+
+                cookTexture(directory / texture.Path, static_cast<Render::TextureRole>(role));
+            }
+        }
+    }
+
+    void Cooker::cookTexture(const std::filesystem::path &path, const Render::TextureRole role) {
+        const std::string variant = Render::GetTextureVariant(role);
+        const std::string key     = m_AssetDatabase->getKey(path, variant);
+
+        if (visit(key))
+            return;
+
+        IGNIS_LOG_APPLICATION_INFO("Cooking texture: '{}'", key);
+
+        std::optional<AssetDatabase::Dependency> dependency = m_AssetDatabase->getDependency(path);
+        if (!dependency.has_value()) {
+            m_Statistics.FailedCount++;
+            return;
+        }
+
+        std::optional<TextureAsset> texture_asset = TextureAsset::LoadFromPath(path, TextureAsset::Type::eRGBA8u);
+        if (!texture_asset.has_value()) {
+            IGNIS_LOG_APPLICATION_ERROR("Failed to load texture: '{}'", key);
+            m_Statistics.FailedCount++;
+            return;
+        }
+
+        const TextureAsset compressed_asset = Render::CompressTexture(texture_asset.value(), role);
+
+        std::vector<AssetDatabase::Dependency> dependencies{};
+        dependencies.push_back(std::move(dependency.value()));
+
+        const AssetDatabase::Entry entry = makeEntry(FormatString("Texture/{}", variant), ".ktx2", std::move(dependencies));
+
+        if (!compressed_asset.saveKTX2(m_AssetDatabase->getCookedPath(entry))) {
+            m_Statistics.FailedCount++;
+            return;
+        }
+
+        m_AssetDatabase->setEntry(key, entry);
+        m_Statistics.CookedCount++;
+    }
+
+    void Cooker::cookEnvironment(const std::filesystem::path &path) {
+        const std::string key = m_AssetDatabase->getKey(path);
+
+        if (visit(key))
+            return;
+
+        IGNIS_LOG_APPLICATION_INFO("Cooking environment: '{}'", key);
+
+        std::optional<AssetDatabase::Dependency> dependency = m_AssetDatabase->getDependency(path);
+        if (!dependency.has_value()) {
+            m_Statistics.FailedCount++;
+            return;
+        }
+
+        // Skyboxes are uploaded as eRGBA32f texels, the cooked file only saves the HDR decode.
+        const std::optional<TextureAsset> texture_asset = TextureAsset::LoadFromPath(path, TextureAsset::Type::eRGBA32f);
+        if (!texture_asset.has_value()) {
+            IGNIS_LOG_APPLICATION_ERROR("Failed to load environment: '{}'", key);
+            m_Statistics.FailedCount++;
+            return;
+        }
+
+        std::vector<AssetDatabase::Dependency> dependencies{};
+        dependencies.push_back(std::move(dependency.value()));
+
+        const AssetDatabase::Entry entry = makeEntry("Environment", ".ktx2", std::move(dependencies));
+
+        if (!texture_asset->saveKTX2(m_AssetDatabase->getCookedPath(entry))) {
+            m_Statistics.FailedCount++;
+            return;
+        }
+
+        m_AssetDatabase->setEntry(key, entry);
+        m_Statistics.CookedCount++;
+    }
+
+    bool Cooker::visit(const std::string &key) {
+        const bool is_first_visit = m_VisitedKeys.insert(key).second;
+
+        const AssetDatabase::Entry *entry = m_AssetDatabase->findEntry(key);
+        if (nullptr == entry || !std::filesystem::exists(m_AssetDatabase->getCookedPath(*entry)))
+            return false;
+
+        // A second visit in one run finds what the first one cooked.
+        if (!is_first_visit)
+            return true;
+
+        if (m_Settings.Force || !m_AssetDatabase->isCurrent(*entry))
+            return false;
+
+        m_Statistics.CurrentCount++;
+        return true;
+    }
+
+    AssetDatabase::Entry Cooker::makeEntry(
+        const std::string_view                   recipe,
+        const std::string_view                   extension,
+        std::vector<AssetDatabase::Dependency> &&dependencies) const {
+        const std::string versioned_recipe = FormatString("{}/{}", recipe, k_Version);
+
+        // Equal recipes over equal content hash alike, wherever the sources live.
+        uint64_t hash = AssetDatabase::HashBytes(versioned_recipe.data(), versioned_recipe.size());
+        for (const AssetDatabase::Dependency &dependency : dependencies)
+            hash = AssetDatabase::HashBytes(&dependency.Hash, sizeof(uint64_t), hash);
+
+        AssetDatabase::Entry entry{};
+        entry.Hash         = hash;
+        entry.Extension    = extension;
+        entry.Dependencies = std::move(dependencies);
+
+        return entry;
+    }
+
+    std::string GetLowercaseExtension(const std::filesystem::path &path) {
+        std::string extension = path.extension().string();
+        std::ranges::transform(extension, std::begin(extension), [](const unsigned char c) {
+            return static_cast<char>(std::tolower(c));
+        });
+        return extension;
+    }
+}  // namespace Ignis
@@ -0,0 +1,61 @@
+#include <Ignis/Cooker.hpp>
+
+int32_t main(
+    const int32_t argc,
+    const char  **argv) {
+    std::vector<std::string_view> arguments{};
+    arguments.resize(argc);
+
+    for (uint32_t i = 0; i < argc; i++) {
+        arguments[i] = argv[i];
+    }
+
+    Ignis::Logger::Settings logger_settings{};
+    logger_settings.ApplicationLogName  = "COOK";
+    logger_settings.EngineLogFileName   = "IGNIS_COOK.log";
+    logger_settings.EngineLogLevel      = spdlog::level::warn;
+    logger_settings.ApplicationLogLevel = spdlog::level::info;
+
+    Ignis::Logger logger{};
+    logger.initialize(logger_settings);
+
+    // Packing only bundles an already cooked directory, no asset is cooked again.
+    if (4 == arguments.size() && "--pack" == arguments[1]) {
+        const bool packed = Ignis::PakArchive::Write(arguments[3], arguments[2]);
+        if (!packed)
+            IGNIS_LOG_APPLICATION_ERROR("Failed to pack '{}' into '{}'", arguments[2], arguments[3]);
+        else
+            IGNIS_LOG_APPLICATION_INFO("Packed '{}' into '{}'", arguments[2], arguments[3]);
+
+        logger.shutdown();
+        return packed ? 0 : 1;
+    }
+
+    Ignis::Cooker::Settings cooker_settings{};
+
+    std::vector<std::string_view> directories{};
+    for (uint32_t i = 1; i < arguments.size(); i++) {
+        if ("--force" == arguments[i])
+            cooker_settings.Force = true;
+        else
+            directories.push_back(arguments[i]);
+    }
+
+    if (2 != directories.size()) {
+        IGNIS_LOG_APPLICATION_ERROR("Usage: IgnisCook <asset root directory> <cache directory> [--force]");
+        IGNIS_LOG_APPLICATION_ERROR("       IgnisCook --pack <directory> <pak file>");
+        logger.shutdown();
+        return 1;
+    }
+
+    cooker_settings.RootDirectory  = directories[0];
+    cooker_settings.CacheDirectory = directories[1];
+
+    Ignis::Cooker cooker{cooker_settings};
+
+    const bool succeeded = cooker.run();
+
+    logger.shutdown();
+
+    return succeeded ? 0 : 1;
+}
@@ -145,7 +145,8 @@ namespace Ignis {
         m_DepthImage = Vulkan::AllocateImage2D(
             {}, vma::MemoryUsage::eGpuOnly, {},
             vk::Format::eD32Sfloat,
-            vk::ImageUsageFlagBits::eDepthStencilAttachment,
+            vk::ImageUsageFlagBits::eDepthStencilAttachment |
+                vk::ImageUsageFlagBits::eSampled,
             m_ViewportExtent);
 
         m_DepthView = Vulkan::CreateImageDepthView2D(m_DepthImage.Handle, m_DepthImage.Format);
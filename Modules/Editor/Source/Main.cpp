@@ -37,6 +37,16 @@ int32_t main(
     engine_settings.RenderSettings.SkyboxPath = "Assets/Textures/black_1x1.png";
     engine_settings.RenderSettings.SkyboxPath = "Assets/Textures/brown_photostudio_02_4k.hdr";
 
+    engine_settings.RenderSettings.AssetRootDirectory  = "Assets";
+    engine_settings.RenderSettings.AssetCacheDirectory = "AssetCache";
+
+    // Packed assets shadow the loose ones, IgnisEditorPak builds them.
+    for (const std::string_view directory : {"Assets", "AssetCache"}) {
+        const std::filesystem::path pak_path = std::filesystem::path{directory}.replace_extension(".pak");
+        if (std::filesystem::exists(pak_path))
+            engine_settings.PakMounts.push_back({pak_path, directory});
+    }
+
     engine_settings.UISystem = std::make_unique<Ignis::ImGuiSystem>();
 
     Ignis::Logger logger{};
@@ -7,6 +7,8 @@ namespace Ignis {
         gtl::flat_hash_map<Render::ModelID, std::vector<Render::InstanceID>> instances_to_remove{};
 
         if (ImGui::CollapsingHeader("Model", ImGuiTreeNodeFlags_DefaultOpen)) {
+            ImGui::TextDisabled("%s", FormatString("Draw sort: {:.3f} ms", Render::GetDrawSortTime() * 1000.0).c_str());
+
             // Load Model Section
             static char model_path[1024];
             ImGui::SetNextItemWidth(-1);
@@ -14,7 +16,7 @@ namespace Ignis {
 
             if (ImGui::Button("Load Model", ImVec2(-1, 0))) {
                 if (const std::string_view path = model_path;
-                    std::filesystem::exists(path)) {
+                    VirtualFileSystem::Exists(path)) {
                     if (const auto model = Render::AddModel(path);
                         Render::k_InvalidModelID != model &&
                         !state.ModelToUIState.contains(model)) {
@@ -126,11 +128,12 @@ namespace Ignis {
 
         // Remove instances
         for (auto &[model, instances] : instances_to_remove) {
+            Render::RemoveInstances(instances);
+
             while (!instances.empty()) {
                 const auto instance = instances.back();
                 instances.pop_back();
 
-                Render::RemoveInstance(instance);
                 state.InstanceToUIState.erase(instance);
 
                 if (const auto it = std::ranges::find(state.ModelToUIState[model].Instances, instance);
@@ -188,6 +191,7 @@ namespace Ignis {
 
                 ImGui::DragFloat3("Position", glm::value_ptr(add_light.Position), 0.01f);
                 ImGui::DragFloat("Power", &add_light.Power, 0.01f, 0.0f);
+                ImGui::DragFloat("Range", &add_light.Range, 0.01f, 0.01f);
                 ImGui::ColorEdit3("Color", glm::value_ptr(add_light.Color));
 
                 if (ImGui::Button("Add", ImVec2(-1, 0))) {
@@ -216,6 +220,7 @@ namespace Ignis {
                         if (ImGui::TreeNode(light_label.c_str())) {
                             bool changed = ImGui::DragFloat3("Position", glm::value_ptr(light.Position), 0.01f);
                             changed |= ImGui::DragFloat("Power", &light.Power, 0.01f, 0.0f);
+                            changed |= ImGui::DragFloat("Range", &light.Range, 0.01f, 0.01f);
                             changed |= ImGui::ColorEdit3("Color", glm::value_ptr(light.Color));
 
                             if (changed) {
@@ -251,6 +256,7 @@ namespace Ignis {
                 ImGui::DragFloat("CutOff", &add_light.CutOff, 0.01f, 0.0f);
                 ImGui::DragFloat("OuterCutOff", &add_light.OuterCutOff, 0.01f, 0.0f);
                 ImGui::DragFloat("Power", &add_light.Power, 0.01f, 0.0f);
+                ImGui::DragFloat("Range", &add_light.Range, 0.01f, 0.01f);
                 ImGui::ColorEdit3("Color", glm::value_ptr(add_light.Color));
 
                 if (ImGui::Button("Add", ImVec2(-1, 0))) {
@@ -286,6 +292,7 @@ namespace Ignis {
                             changed |= ImGui::DragFloat("CutOff", &light.CutOff, 0.01f, 0.0f);
                             changed |= ImGui::DragFloat("OuterCutOff", &light.OuterCutOff, 0.01f, 0.0f);
                             changed |= ImGui::DragFloat("Power", &light.Power, 0.01f, 0.0f);
+                            changed |= ImGui::DragFloat("Range", &light.Range, 0.01f, 0.01f);
                             changed |= ImGui::ColorEdit3("Color", glm::value_ptr(light.Color));
 
                             if (changed) {
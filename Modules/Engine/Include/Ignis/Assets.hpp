@@ -1,5 +1,9 @@
 #pragma once
 
+#include <Ignis/Assets/PakArchive.hpp>
+#include <Ignis/Assets/VirtualFileSystem.hpp>
 #include <Ignis/Assets/FileAsset.hpp>
 #include <Ignis/Assets/TextureAsset.hpp>
-#include <Ignis/Assets/AssimpAsset.hpp>
\ No newline at end of file
+#include <Ignis/Assets/BlockCompressor.hpp>
+#include <Ignis/Assets/AssimpAsset.hpp>
+#include <Ignis/Assets/AssetDatabase.hpp>
\ No newline at end of file
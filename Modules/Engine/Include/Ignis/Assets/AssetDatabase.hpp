@@ -0,0 +1,74 @@
+#pragma once
+
+#include <Ignis/Core.hpp>
+
+namespace Ignis {
+    class AssetDatabase {
+       public:
+        static constexpr std::string_view k_ManifestName    = "Manifest.txt";
+        static constexpr uint32_t         k_ManifestVersion = 1;
+
+        struct Dependency {
+            // Relative to the root directory, in generic form.
+            std::string Path;
+
+            // Size and write time only decide when the content has to be hashed again.
+            uint64_t Size;
+            int64_t  WriteTime;
+            uint64_t Hash;
+        };
+
+        struct Entry {
+            // Names the cooked file, identical inputs share one file.
+            uint64_t    Hash;
+            std::string Extension;
+
+            // The source comes first, followed by every file the cooked result was built from.
+            std::vector<Dependency> Dependencies;
+        };
+
+       public:
+        static std::optional<AssetDatabase> Open(const std::filesystem::path &root_directory, const std::filesystem::path &cache_directory);
+
+        static uint64_t                HashBytes(const void *data, size_t size, uint64_t seed = 0);
+        static std::optional<uint64_t> HashFile(const std::filesystem::path &path);
+
+       public:
+        AssetDatabase()  = default;
+        ~AssetDatabase() = default;
+
+        bool save() const;
+
+        // Keys are source paths relative to the root, a variant separates cooks of one source with different settings.
+        std::string getKey(const std::filesystem::path &source_path, std::string_view variant = {}) const;
+
+        // Fills in the size, write time and content hash of a dependency.
+        std::optional<Dependency> getDependency(const std::filesystem::path &path) const;
+
+        const Entry *findEntry(const std::string &key) const;
+
+        // The cooked file of a current entry, sources missing from disk are trusted as they were cooked.
+        std::optional<std::filesystem::path> findCooked(const std::filesystem::path &source_path, std::string_view variant = {}) const;
+
+        bool isCurrent(const Entry &entry) const;
+
+        void setEntry(const std::string &key, const Entry &entry);
+        void removeEntry(const std::string &key);
+
+        // Deletes cooked files no entry refers to.
+        uint32_t removeUnreferenced() const;
+
+        std::filesystem::path getCookedPath(const Entry &entry) const;
+
+        const std::filesystem::path &getRootDirectory() const;
+        const std::filesystem::path &getCacheDirectory() const;
+
+        const gtl::flat_hash_map<std::string, Entry> &getEntries() const;
+
+       private:
+        std::filesystem::path m_RootDirectory;
+        std::filesystem::path m_CacheDirectory;
+
+        gtl::flat_hash_map<std::string, Entry> m_Entries;
+    };
+}  // namespace Ignis
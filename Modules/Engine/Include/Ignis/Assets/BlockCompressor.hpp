@@ -0,0 +1,24 @@
+#pragma once
+
+#include <Ignis/Core.hpp>
+
+namespace Ignis {
+    class BlockCompressor {
+       public:
+        static constexpr uint32_t k_BlockDimension  = 4;
+        static constexpr uint32_t k_BlockTexelCount = k_BlockDimension * k_BlockDimension;
+
+        // 4x4 RGBA8 texels, row-major.
+        using Block = std::array<glm::u8vec4, k_BlockTexelCount>;
+
+       public:
+        // Opaque RGB at 4 bits per texel, alpha is ignored.
+        static void EncodeBC1(const Block &block, std::span<uint8_t, 8> output);
+        // The red channel at 4 bits per texel.
+        static void EncodeBC4(const Block &block, std::span<uint8_t, 8> output);
+        // The red and green channels at 8 bits per texel, each encoded like BC4.
+        static void EncodeBC5(const Block &block, std::span<uint8_t, 16> output);
+        // RGBA at 8 bits per texel, always in mode 6 with a single subset.
+        static void EncodeBC7(const Block &block, std::span<uint8_t, 16> output);
+    };
+}  // namespace Ignis
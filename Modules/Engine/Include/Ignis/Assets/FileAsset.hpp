@@ -5,22 +5,37 @@
 namespace Ignis {
     class FileAsset {
        public:
+        // Files on disk are memory mapped, the bytes are paged in as they are read.
         static std::optional<FileAsset> LoadTextFromPath(const std::filesystem::path &path);
         static std::optional<FileAsset> LoadBinaryFromPath(const std::filesystem::path &path);
 
         static FileAsset LoadFromMemory(const std::filesystem::path &path, std::string_view content);
+        static FileAsset LoadFromMemory(const std::filesystem::path &path, std::string &&content);
+
+        // Views bytes that the owner keeps alive, such as an entry inside a mapped pak archive.
+        static FileAsset LoadFromSharedMemory(const std::filesystem::path &path, std::shared_ptr<const std::byte> data, size_t size);
 
        public:
         FileAsset()  = default;
         ~FileAsset() = default;
 
         std::filesystem::path getPath() const;
-        std::string_view      getContent() const;
+
+        // Stays valid while any copy of the asset or a view made from it is alive, moves included.
+        std::span<const std::byte> getBytes() const;
+        std::string_view           getContent() const;
+
+        const std::shared_ptr<const std::byte> &getSharedData() const;
 
         size_t getSize() const;
 
+       private:
+        static std::optional<FileAsset> MapFromPath(const std::filesystem::path &path);
+
        private:
         std::filesystem::path m_Path;
-        std::string           m_Content;
+
+        std::shared_ptr<const std::byte> m_Data;
+        size_t                           m_Size = 0;
     };
-}  // namespace Ignis
\ No newline at end of file
+}  // namespace Ignis
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <Ignis/Core.hpp>
+
+#include <Ignis/Assets/FileAsset.hpp>
+
+namespace Ignis {
+    class PakArchive {
+       public:
+        static constexpr std::array<char, 4> k_Magic{'I', 'P', 'A', 'K'};
+        static constexpr uint32_t            k_Version = 1;
+
+        // Stored entries start on a page so they can be mapped in place, compressed ones are decoded anyway.
+        static constexpr uint64_t k_PageAlignment  = 4096;
+        static constexpr uint64_t k_EntryAlignment = 16;
+
+        enum class Compression : uint32_t {
+            eNone = 0,
+            eLZ4  = 1,
+        };
+
+        struct Header {
+            std::array<char, 4> Magic;
+            uint32_t            Version;
+            uint32_t            EntryCount;
+            uint32_t            Reserved;
+            uint64_t            IndexOffset;
+            uint64_t            NamesOffset;
+            uint64_t            NamesSize;
+        };
+
+        // Entries are sorted by path hash, names settle the rare collisions.
+        struct Entry {
+            uint64_t    PathHash;
+            uint64_t    Offset;
+            uint64_t    StoredSize;
+            uint64_t    Size;
+            uint32_t    NameOffset;
+            uint32_t    NameSize;
+            Compression Codec;
+            uint32_t    Reserved;
+        };
+
+       public:
+        static std::optional<std::unique_ptr<PakArchive>> Open(const std::filesystem::path &path);
+
+        // Packs every file under the directory, named by its generic path relative to it.
+        static bool Write(const std::filesystem::path &pak_path, const std::filesystem::path &directory);
+
+        static uint64_t HashPath(std::string_view name);
+
+       public:
+        PakArchive()  = default;
+        ~PakArchive() = default;
+
+        PakArchive(const PakArchive &)            = delete;
+        PakArchive &operator=(const PakArchive &) = delete;
+
+        const Entry *find(std::string_view name) const;
+
+        std::optional<FileAsset> read(const Entry &entry) const;
+
+        std::string_view getName(const Entry &entry) const;
+
+        const std::filesystem::path &getPath() const;
+        const std::vector<Entry>    &getEntries() const;
+
+       private:
+        std::filesystem::path m_Path;
+
+        // The whole archive stays mapped, names and stored entries are views into it.
+        FileAsset m_File;
+
+        std::vector<Entry> m_Entries;
+        std::string_view   m_Names;
+    };
+}  // namespace Ignis
@@ -12,34 +12,104 @@ namespace Ignis {
             eRGB16u,
             eRGBA8u,
             eRGB8u,
+            // Block-compressed, 4x4 texels per block.
+            eBC1,
+            eBC2,
+            eBC3,
+            eBC4,
+            eBC5,
+            eBC6H,
+            eBC7,
+        };
+
+        // Hands out the memory texels are written into, such as a mapped staging buffer, instead of a vector the asset owns.
+        // It sees the asset with its extent and format filled in, and an empty span refuses the load.
+        using Allocator = fu2::function<std::span<uint8_t>(const TextureAsset &texture_asset, uint64_t size) const>;
+
+        // The mip levels a container load keeps, the others are neither decoded nor allocated.
+        struct MipRange {
+            uint32_t First = 0;
+            uint32_t Count = ~0u;
+
+            // Also skips the leading levels wider or taller than this, the smallest level is always kept.
+            uint32_t MaxExtent = ~0u;
         };
 
        public:
-        static std::optional<TextureAsset> LoadFromPath(const std::filesystem::path &path, Type type = Type::eRGBA8u);
-        static std::optional<TextureAsset> LoadFromMemory(const void *data, size_t size, Type type = Type::eRGBA8u);
+        static std::optional<TextureAsset> LoadFromPath(const std::filesystem::path &path, Type type = Type::eRGBA8u, const Allocator &allocator = {});
+        static std::optional<TextureAsset> LoadFromMemory(const void *data, size_t size, Type type = Type::eRGBA8u, const Allocator &allocator = {});
+
+        // Containers keep their own format, mip levels and array layers, cube faces are loaded as layers.
+        static std::optional<TextureAsset> LoadKTX2FromPath(const std::filesystem::path &path, const Allocator &allocator = {}, const MipRange &mip_range = {});
+        static std::optional<TextureAsset> LoadKTX2FromMemory(const void *data, size_t size, const Allocator &allocator = {}, const MipRange &mip_range = {});
+        static std::optional<TextureAsset> LoadDDSFromPath(const std::filesystem::path &path, const Allocator &allocator = {}, const MipRange &mip_range = {});
+        static std::optional<TextureAsset> LoadDDSFromMemory(const void *data, size_t size, const Allocator &allocator = {}, const MipRange &mip_range = {});
 
         static uint8_t  GetChannelCount(Type type);
         static uint32_t GetChannelSize(Type type);
 
+        static bool     IsBlockCompressed(Type type);
+        static uint32_t GetBlockSize(Type type);
+        static uint64_t GetImageSize(Type type, uint32_t width, uint32_t height);
+
+        static vk::Format GetFormat(Type type, bool is_srgb);
+
         static void SetFlipVertically(bool flip);
 
        public:
         TextureAsset()  = default;
         ~TextureAsset() = default;
 
+        // Box-filters the base level of an eRGBA8u texture down to 1x1, sRGB data is averaged in linear space and the texture is marked sRGB.
+        void generateMipLevels(bool is_srgb);
+
+        // Encodes every mip level of an eRGBA8u texture into a block-compressed type.
+        TextureAsset compress(Type type, const Allocator &allocator = {}) const;
+
+        // Writes every mip level and layer as a Zstandard-supercompressed KTX2 file.
+        bool saveKTX2(const std::filesystem::path &path) const;
+
         uint32_t getWidth() const;
         uint32_t getHeight() const;
 
+        // The whole mip chain, of which only the resident levels have data.
+        uint32_t getMipLevelCount() const;
+        uint32_t getFirstMipLevel() const;
+        uint32_t getResidentMipLevelCount() const;
+        uint32_t getLayerCount() const;
+        uint32_t getMipWidth(uint32_t mip_level) const;
+        uint32_t getMipHeight(uint32_t mip_level) const;
+        // Relative to the first resident level.
+        uint64_t getMipOffset(uint32_t mip_level) const;
+
         Type getType() const;
+        bool isSRGB() const;
 
         std::span<const uint8_t> getData() const;
+        std::span<const uint8_t> getMipData(uint32_t mip_level) const;
+
+       private:
+        bool allocateData(uint64_t size, const Allocator &allocator);
+
+        void selectMipLevels(const MipRange &mip_range);
+
+        std::span<uint8_t> getMutableData();
 
        private:
         uint32_t m_Width;
         uint32_t m_Height;
+        uint32_t m_MipLevelCount = 1;
+        uint32_t m_LayerCount    = 1;
+
+        uint32_t m_FirstMipLevel         = 0;
+        uint32_t m_ResidentMipLevelCount = 1;
 
         Type m_Type;
+        bool m_IsSRGB = false;
 
         std::vector<uint8_t> m_Data;
+
+        // Set when the texels live in memory an allocator handed out, the asset only views it then.
+        std::span<uint8_t> m_ExternalData;
     };
 }  // namespace Ignis
\ No newline at end of file
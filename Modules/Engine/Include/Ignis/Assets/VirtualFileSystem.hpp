@@ -0,0 +1,50 @@
+#pragma once
+
+#include <Ignis/Core.hpp>
+
+#include <Ignis/Assets/PakArchive.hpp>
+
+#include <assimp/DefaultIOSystem.h>
+
+namespace Ignis {
+    class VirtualFileSystem {
+       public:
+        struct PakMount {
+            std::filesystem::path PakPath;
+            std::filesystem::path MountPoint;
+        };
+
+       public:
+        // Paths under the mount point are served from the pak, the latest mount wins over earlier ones and the disk.
+        static bool Mount(const std::filesystem::path &pak_path, const std::filesystem::path &mount_point);
+        static void Unmount(const std::filesystem::path &mount_point);
+        static void UnmountAll();
+
+        static bool IsMounted(const std::filesystem::path &path);
+        static bool Exists(const std::filesystem::path &path);
+
+        // Only mounted files are read here, a miss means the caller reads the disk.
+        static std::optional<FileAsset> ReadMounted(const std::filesystem::path &path);
+
+       private:
+        struct MountedPak {
+            std::string                 MountPoint;
+            std::unique_ptr<PakArchive> Archive;
+        };
+
+        // The archive and entry a path resolves to, callers hold the lock.
+        static std::pair<const PakArchive *, const PakArchive::Entry *> Resolve(const std::filesystem::path &path);
+
+       private:
+        static std::vector<MountedPak> s_Mounts;
+        static std::shared_mutex       s_MountsMutex;
+    };
+
+    // Lets Assimp open model files and their side files through mounted paks and file mappings.
+    class VirtualIOSystem : public Assimp::DefaultIOSystem {
+       public:
+        bool Exists(const char *file) const override;
+
+        Assimp::IOStream *Open(const char *file, const char *mode) override;
+    };
+}  // namespace Ignis
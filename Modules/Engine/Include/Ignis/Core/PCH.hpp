@@ -2,23 +2,30 @@
 
 #include <Ignis/Core/Defines.hpp>
 
+#include <bit>
 #include <span>
 #include <queue>
 #include <deque>
 #include <tuple>
 #include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <condition_variable>
 #include <array>
 #include <vector>
 #include <string>
+#include <cctype>
 #include <ranges>
 #include <random>
 #include <format>
 #include <chrono>
+#include <charconv>
 #include <atomic>
 #include <memory>
 #include <fstream>
 #include <variant>
 #include <utility>
+#include <numeric>
 #include <optional>
 #include <algorithm>
 #include <execution>
@@ -62,4 +69,6 @@
 
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
-#include <assimp/postprocess.h>
\ No newline at end of file
+#include <assimp/postprocess.h>
+
+#include <xxhash.h>
\ No newline at end of file
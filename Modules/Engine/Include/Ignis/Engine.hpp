@@ -20,6 +20,9 @@ namespace Ignis {
             Frame::Settings  FrameSettings{};
             Render::Settings RenderSettings{};
 
+            // Mounted before anything loads, so every asset can come from a pak.
+            std::vector<VirtualFileSystem::PakMount> PakMounts{};
+
             std::unique_ptr<IGUISystem> UISystem = nullptr;
         };
 
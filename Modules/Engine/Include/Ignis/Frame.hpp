@@ -25,6 +25,9 @@ namespace Ignis {
 
         FrameGraph &getFrameGraph();
 
+        uint32_t getFrameIndex() const;
+        uint32_t getFramesInFlight() const;
+
        private:
         IGNIS_IF_DEBUG(class State {
            public:
@@ -57,6 +57,78 @@ namespace Ignis {
         static constexpr InstanceID k_InvalidInstanceID{~0u};
         static constexpr ModelID    k_InvalidModelID{~0u};
 
+        static constexpr uint32_t k_TexturesPerPage  = 1024;
+        static constexpr uint32_t k_MaterialsPerPage = 1024;
+        static constexpr uint32_t k_LightsPerPage    = 1024;
+        static constexpr uint32_t k_InstancesPerPage = 1024;
+
+        static constexpr uint32_t k_MaxInstancePagesPerModel = 1024;
+
+        static constexpr uint32_t k_MaxDepthPyramidMipCount = 16;
+
+        static constexpr uint32_t k_ClusterGridSizeX    = 16;
+        static constexpr uint32_t k_ClusterGridSizeY    = 9;
+        static constexpr uint32_t k_ClusterGridSizeZ    = 24;
+        static constexpr uint32_t k_ClusterCount        = k_ClusterGridSizeX * k_ClusterGridSizeY * k_ClusterGridSizeZ;
+        static constexpr uint32_t k_MaxLightsPerCluster = 256;
+
+        static constexpr uint32_t k_MaterialFeatureAlbedoMap            = 1u << 0;
+        static constexpr uint32_t k_MaterialFeatureNormalMap            = 1u << 1;
+        static constexpr uint32_t k_MaterialFeatureEmissiveMap          = 1u << 2;
+        static constexpr uint32_t k_MaterialFeatureOcclusionMap         = 1u << 3;
+        static constexpr uint32_t k_MaterialFeatureMetallicRoughnessMap = 1u << 4;
+        static constexpr uint32_t k_MaterialFeatureMetallicMap          = 1u << 5;
+        static constexpr uint32_t k_MaterialFeatureRoughnessMap         = 1u << 6;
+        static constexpr uint32_t k_MaterialFeatureAll                  = (1u << 7) - 1;
+
+        // Draw sort keys, most significant first: material features, material, view depth, draw index.
+        static constexpr uint32_t k_DrawSortIndexBits     = 20;
+        static constexpr uint32_t k_DrawSortDepthShift    = 20;
+        static constexpr uint32_t k_DrawSortMaterialBits  = 17;
+        static constexpr uint32_t k_DrawSortMaterialShift = 40;
+        static constexpr uint32_t k_DrawSortFeatureShift  = 57;
+        static constexpr uint32_t k_MaxDrawCount          = 1u << k_DrawSortIndexBits;
+
+        // One texture slot per TextureRole.
+        static constexpr uint32_t k_TextureRoleCount = 7;
+
+        // How many frames of streaming budget the stream thread may decode ahead of the uploads.
+        static constexpr uint32_t k_TextureStreamAheadFrames = 4;
+
+        // Bump the version whenever the cooked layout, Vertex or Mesh changes.
+        static constexpr uint32_t         k_CookedModelMagic     = 0x4D434749;
+        static constexpr uint32_t         k_CookedModelVersion   = 1;
+        static constexpr uint32_t         k_InvalidCookedTexture = ~0u;
+        static constexpr std::string_view k_CookedModelExtension = ".imodel";
+
+        // Every strategy is written by copies recorded into the next frame, so frames in flight never see a partial
+        // update. The strategy only picks the memory the GPU reads from.
+        enum class UploadStrategy : uint32_t {
+            // Device-local memory.
+            eStaged,
+            // Host-visible device-local memory when VMA reports it, device-local otherwise.
+            eReBAR,
+            // Host memory read by the GPU across the bus.
+            eHost,
+        };
+
+        enum class CullingMode : uint32_t {
+            // A compute pass tests every mesh instance before the model pass.
+            eGPU,
+            // Worker threads test every model instance and upload the visible lists.
+            eCPU,
+        };
+
+        enum class TextureRole : uint32_t {
+            eAlbedo,
+            eEmissive,
+            eNormal,
+            eOcclusion,
+            eMetallicRoughness,
+            eMetallic,
+            eRoughness,
+        };
+
         struct Material {
             glm::vec3 AlbedoFactor{1.0f};
             glm::f32  MetallicFactor{1.0f};
@@ -72,7 +144,15 @@ namespace Ignis {
             TextureID MetallicTexture{k_InvalidTextureID};
             TextureID RoughnessTexture{k_InvalidTextureID};
 
-            glm::f32 _ignis_padding{};
+            // The k_MaterialFeature bits of the maps this material really has, the rest point at default maps.
+            glm::u32 Features{k_MaterialFeatureAll};
+        };
+
+        struct TextureState {
+            // Each texture owns two descriptor slots, a rebuilt image is bound at the one the frames in flight do not use.
+            glm::u32 Slot{0u};
+            // The level of the full mip chain the bound image starts at, feedback is written against the full chain.
+            glm::u32 FirstMipLevel{0u};
         };
 
         struct DirectionalLight {
@@ -83,12 +163,12 @@ namespace Ignis {
             glm::f32 _ignis_padding1{};
         };
 
+        // Lights fade out to nothing at Range, which also bounds them for cluster binning.
         struct PointLight {
             glm::vec3 Position{0.0f};
             glm::f32  Power{1.0f};
             glm::vec3 Color{0.0f};
-
-            glm::f32 _ignis_padding{};
+            glm::f32  Range{10.0f};
         };
 
         struct SpotLight {
@@ -98,6 +178,9 @@ namespace Ignis {
             glm::f32  CutOff{12.5f};
             glm::vec3 Color{0.0f};
             glm::f32  OuterCutOff{15.0f};
+            glm::f32  Range{10.0f};
+
+            glm::f32 _ignis_padding[3]{};
         };
 
         struct LightData {
@@ -107,13 +190,27 @@ namespace Ignis {
             glm::f32 _ignis_padding[2]{};
         };
 
+        struct ClusterData {
+            glm::mat4x4 View;
+            glm::mat4x4 InverseProjection;
+
+            glm::vec2 ScreenSize;
+
+            glm::f32 Near;
+            glm::f32 Far;
+        };
+
         struct Mesh {
             glm::mat4x4 VertexTransform;
             glm::mat4x4 NormalTransform;
 
+            glm::vec4 BoundingSphere;
+
+            glm::vec3  BoundsMin;
             MaterialID Material;
+            glm::vec3  BoundsMax;
 
-            glm::f32 _ignis_padding[3];
+            glm::f32 _ignis_padding;
         };
 
         struct Instance {
@@ -121,17 +218,43 @@ namespace Ignis {
             glm::mat4x4 NormalTransform;
         };
 
+        struct DrawRecord {
+            ModelID  Model;
+            uint32_t Mesh;
+            uint32_t InstanceBase;
+
+            glm::u32 _ignis_padding{};
+        };
+
+        struct GeometryAllocation {
+            vma::VirtualAllocation Allocation;
+
+            uint32_t Offset;
+            uint32_t Count;
+        };
+
         struct Model {
             std::string Path;
 
             uint32_t MeshCount;
             uint32_t InstanceCount;
 
-            Vulkan::Buffer VertexBuffer;
-            Vulkan::Buffer IndexBuffer;
+            GeometryAllocation VertexAllocation;
+            GeometryAllocation IndexAllocation;
+
             Vulkan::Buffer MeshBuffer;
-            Vulkan::Buffer InstanceBuffer;
-            Vulkan::Buffer IndirectBuffer;
+            Vulkan::Buffer InstancePageTable;
+
+            glm::vec3 BoundsMin;
+            glm::vec3 BoundsMax;
+            glm::vec4 BoundingSphere;
+
+            std::vector<Mesh>     Meshes;
+            std::vector<uint32_t> Draws;
+            std::vector<uint32_t> InstancePages;
+            std::vector<Instance> Instances;
+
+            std::vector<vk::DrawIndexedIndirectCommand> IndirectCommands;
 
             gtl::flat_hash_map<MeshID, uint32_t> MeshToIndex;
             gtl::flat_hash_map<uint32_t, MeshID> IndexToMesh;
@@ -160,6 +283,63 @@ namespace Ignis {
             glm::vec4 Tangent{0.0f};
         };
 
+        struct CookedMaterial {
+            std::string Name;
+            uint32_t    Index;
+
+            glm::vec3 AlbedoFactor;
+            glm::f32  MetallicFactor;
+            glm::vec3 EmissiveFactor;
+            glm::f32  RoughnessFactor;
+
+            // Indexed by TextureRole, each entry indexes CookedModel::Textures.
+            std::array<uint32_t, k_TextureRoleCount> Textures;
+        };
+
+        struct CookedTexture {
+            // Relative to the model's directory, embedded textures keep Assimp's "*N" name.
+            std::string Path;
+            // Lowercase, with the leading dot, picks the texture loader.
+            std::string Extension;
+
+            // The encoded image of an embedded texture, empty for textures on disk.
+            std::span<const uint8_t> EmbeddedData;
+        };
+
+        // Spans point into File, so a cooked model is only ever moved.
+        struct CookedModel {
+            CookedModel()                               = default;
+            CookedModel(CookedModel &&)                 = default;
+            CookedModel &operator=(CookedModel &&)      = default;
+            CookedModel(const CookedModel &)            = delete;
+            CookedModel &operator=(const CookedModel &) = delete;
+
+            FileAsset File;
+
+            uint64_t SourceSize;
+            int64_t  SourceWriteTime;
+
+            uint32_t VertexCount;
+            uint32_t IndexCount;
+
+            std::span<const uint8_t> VertexData;
+            std::span<const uint8_t> IndexData;
+
+            glm::vec3 BoundsMin;
+            glm::vec3 BoundsMax;
+            glm::vec4 BoundingSphere;
+
+            // Mesh::Material holds an index into Materials until the model is registered.
+            std::vector<Mesh>                           Meshes;
+            std::vector<vk::DrawIndexedIndirectCommand> IndirectCommands;
+
+            std::vector<CookedMaterial> Materials;
+            std::vector<CookedTexture>  Textures;
+
+            // Every file the importer read, the source first. Only filled by ImportModel.
+            std::vector<std::filesystem::path> SourceFiles;
+        };
+
         struct DrawPC {
             glm::mat4x4 ProjectionView;
 
@@ -167,7 +347,29 @@ namespace Ignis {
 
             glm::f32 MaxPrefilterMipLevel;
 
-            ModelID Model;
+            // SV_DrawIndex restarts for every indirect call, this is the draw the call starts at.
+            glm::u32 DrawBase;
+
+            // Where this frame's slice of the texture feedback buffer starts.
+            glm::u32 FeedbackBase;
+
+            glm::u32 _ignis_padding[2]{};
+        };
+
+        struct CullPC {
+            glm::mat4x4 ProjectionView;
+
+            glm::vec2 DepthSize;
+            glm::vec2 DepthPyramidSize;
+
+            glm::u32 DepthPyramidMipCount;
+            glm::u32 Phase;
+            glm::u32 DrawCount;
+            glm::u32 InstanceCount;
+        };
+
+        struct DepthPyramidPC {
+            glm::u32 Level;
         };
 
         struct Settings {
@@ -178,8 +380,43 @@ namespace Ignis {
             uint32_t PrefilterResolution  = 256;
             uint32_t IrradianceResulution = 32;
 
+            // Material textures take two bindings each, so streaming can rebind one without touching frames in flight.
             uint32_t MaxBindingCount = 2 << 20;
 
+            uint32_t InitialVertexCapacity = 1 << 20;
+            uint32_t InitialIndexCapacity  = 1 << 22;
+
+            uint32_t InitialDrawCapacity = 1 << 8;
+
+            UploadStrategy InstanceUploadStrategy = UploadStrategy::eReBAR;
+
+            CullingMode Culling = CullingMode::eGPU;
+
+            // Two-phase occlusion culling against a depth pyramid, only used with CullingMode::eGPU.
+            bool OcclusionCulling = true;
+
+            // Lays down depth with a position-only pass first, so the shading pass runs once per pixel.
+            bool DepthPrePass = false;
+
+            // Encodes material textures into BC formats at load, picked by the role of each texture.
+            // Ignored on devices without BC support, textures are uploaded as RGBA8 there.
+            bool CompressTextures = true;
+
+            // Textures shipped with a mip chain draw from their resident tail at once, the larger levels the shading
+            // asks for stream in from a background thread under this many bytes per frame. Zero loads every level.
+            uint64_t TextureStreamingBudget = 1 << 24;
+
+            // The levels no wider or taller than this are the resident tail, they are never evicted.
+            uint32_t TextureStreamingTailExtent = 128;
+
+            // Streamed levels are evicted least recently sampled first to stay under this many bytes, and under what
+            // the heap budget leaves over. Zero only follows the heap budget.
+            uint64_t TextureMemoryBudget = 0;
+
+            // Cooked assets are looked up by their path relative to the root, an empty cache directory disables the lookup.
+            std::filesystem::path AssetRootDirectory{"Assets"};
+            std::filesystem::path AssetCacheDirectory{};
+
             FrameGraph *pFrameGraph = nullptr;
         };
 
@@ -204,18 +441,47 @@ namespace Ignis {
         static PointLight       GetPointLight(PointLightID id);
         static SpotLight        GetSpotLight(SpotLightID id);
 #pragma endregion
+#pragma region Draw
+        // CPU time spent building and sorting the draw list last frame.
+        static double GetDrawSortTime();
+#pragma endregion
 #pragma region Model
         static void SetInstance(InstanceID id, const glm::mat4x4 &transform);
+        static void SetInstances(std::span<const InstanceID> ids, std::span<const glm::mat4x4> transforms);
 
-        static ModelID    AddModel(const std::filesystem::path &path);
-        static InstanceID AddInstance(ModelID model_id, const glm::mat4x4 &transform);
+        static ModelID                 AddModel(const std::filesystem::path &path);
+        static InstanceID              AddInstance(ModelID model_id, const glm::mat4x4 &transform);
+        static std::vector<InstanceID> AddInstances(ModelID model_id, std::span<const glm::mat4x4> transforms);
 
         static void RemoveModel(ModelID id);
         static void RemoveInstance(InstanceID id);
+        static void RemoveInstances(std::span<const InstanceID> ids);
 
         static std::string_view GetModelPath(ModelID id);
 
-        static glm::mat4x4 GetInstance(InstanceID id);
+        static const Model &GetModel(ModelID id);
+        static Mesh         GetMesh(MeshID id);
+        static glm::mat4x4  GetInstance(InstanceID id);
+#pragma endregion
+#pragma region Cook
+        // Imports a source model with Assimp, MikkTSpace tangents included, and lays it out as a cooked model.
+        static std::optional<CookedModel> ImportModel(const std::filesystem::path &path);
+
+        static std::optional<CookedModel> LoadCookedModel(const std::filesystem::path &path);
+        static bool                       SaveCookedModel(const CookedModel &model, const std::filesystem::path &path);
+
+        // The cooked file sits next to its source, with k_CookedModelExtension appended.
+        static std::filesystem::path GetCookedModelPath(const std::filesystem::path &source_path);
+
+        static bool IsCookedModelCurrent(const CookedModel &model, const std::filesystem::path &source_path);
+
+        // Builds the mip chain of an eRGBA8u texture and encodes it into the block format of its role.
+        static TextureAsset CompressTexture(TextureAsset &texture_asset, TextureRole role, const TextureAsset::Allocator &allocator = {});
+
+        static bool IsTextureRoleSRGB(TextureRole role);
+
+        // Names the cook of a texture for one role in the asset database.
+        static std::string GetTextureVariant(TextureRole role);
 #pragma endregion
        public:
         void initialize(const Settings &settings);
@@ -229,7 +495,265 @@ namespace Ignis {
             ~State();
         };);
 
+        struct PagePool {
+            uint64_t ElementSize;
+            uint32_t ElementsPerPage;
+
+            vk::BufferUsageFlags    Usage;
+            vk::PipelineStageFlags2 StageMask;
+            UploadStrategy          Strategy;
+
+            vk::DescriptorSet DescriptorSet;
+            uint32_t          Binding;
+
+            std::vector<Vulkan::Buffer>         Pages;
+            std::vector<FrameGraph::BufferInfo> FrameGraphPages;
+            std::vector<uint32_t>               FreePages;
+
+            // Freed pages may still be read by frames in flight, they wait a full round of frame indices before reuse.
+            std::vector<uint32_t>              ReleasedPages;
+            std::vector<std::vector<uint32_t>> RetiredPages;
+        };
+
+        enum class CullPhase : uint32_t {
+            // Frustum culling only.
+            eAll,
+            // Instances visible last frame, drawn to build this frame's depth pyramid.
+            eEarly,
+            // Every other instance, tested against the depth pyramid.
+            eLate,
+        };
+
+        struct MaterialDrawRange {
+            uint32_t Features;
+            uint32_t FirstDraw;
+            uint32_t DrawCount;
+        };
+
+        struct CullChunk {
+            ModelID  Model;
+            uint32_t First;
+            uint32_t Count;
+            uint32_t SlotBase;
+            uint32_t VisibleCount;
+        };
+
+        struct PendingUpload {
+            vk::Buffer Buffer;
+            uint64_t   Offset;
+            uint64_t   StagingOffset;
+            uint64_t   Size;
+        };
+
+        struct StreamingTexture {
+            // Tells the texture apart from a later one reusing its ID, levels decoded for the old one are dropped.
+            uint64_t Serial;
+
+            // The container the levels are decoded from, it stays mapped so evicted levels can come back.
+            FileAsset File;
+            bool      IsKTX2;
+
+            vk::Format   Format;
+            vk::Extent2D Extent;
+            uint32_t     MipLevelCount;
+            uint32_t     LayerCount;
+
+            // The bound image holds the levels from ResidentMipLevel on, the tail from TailMipLevel on is never evicted.
+            uint32_t ResidentMipLevel;
+            uint32_t TailMipLevel;
+            // Raised past a level that failed to decode, so it is not asked for again.
+            uint32_t FinestMipLevel;
+
+            // The finest level the shading asked for, and the residency frame it was last sampled in.
+            uint32_t RequestedMipLevel;
+            uint64_t LastUsedFrame;
+
+            // The bound slot of the two, the other is free once the rebuild frame has left flight.
+            uint32_t SlotParity;
+            uint64_t RebuildFrame;
+
+            uint64_t ImageSize;
+            bool     IsStreaming;
+        };
+
+        struct StreamRequest {
+            TextureID ID;
+            uint64_t  Serial;
+            uint32_t  MipLevel;
+
+            FileAsset File;
+            bool      IsKTX2;
+        };
+
+        struct StreamResult {
+            TextureID ID;
+            uint64_t  Serial;
+            uint32_t  MipLevel;
+
+            // The level is decoded into the staging buffer, the asset only views it.
+            Vulkan::Buffer              StagingBuffer;
+            std::optional<TextureAsset> Asset;
+        };
+
+        struct TextureRebuild {
+            vk::Image SrcImage;
+            vk::Image DstImage;
+
+            // Holds the first level of the new image when one streams in, null when levels are evicted.
+            vk::Buffer StagingBuffer;
+
+            // The levels of the full chain each image starts at.
+            uint32_t SrcMipLevel;
+            uint32_t DstMipLevel;
+
+            uint32_t     MipLevelCount;
+            uint32_t     LayerCount;
+            vk::Extent2D Extent;
+        };
+
+        struct StreamRetirement {
+            std::vector<Vulkan::Buffer> Buffers;
+            std::vector<Vulkan::Image>  Images;
+            std::vector<vk::ImageView>  Views;
+        };
+
+        // Read, decoded and encoded by an import job, the render thread only uploads and registers it.
+        struct PreparedTexture {
+            uint32_t    TextureIndex;
+            TextureRole Role;
+
+            std::string Key;
+
+            // Unset when the key was already loaded, nothing is decoded then.
+            std::optional<FileAsset> File;
+            bool                     IsKTX2;
+            bool                     HasMipLevels;
+            vk::Format               Format;
+
+            // The compressed asset is uploaded when there is one, whichever is uploaded lives in the staging buffer.
+            // The decoded asset is dropped once compressed, only its extent is kept.
+            Vulkan::Buffer              StagingBuffer;
+            std::optional<TextureAsset> Asset;
+            std::optional<TextureAsset> CompressedAsset;
+            vk::Extent2D                Extent;
+        };
+
        private:
+#pragma region Upload
+        void initializeUploads(const Settings &settings);
+        void releaseUploads();
+
+        [[nodiscard]] Vulkan::Buffer allocateUploadBuffer(
+            UploadStrategy       strategy,
+            uint64_t             size,
+            vk::BufferUsageFlags usage) const;
+
+        void uploadToBuffer(const Vulkan::Buffer &buffer, uint64_t offset, const void *data, uint64_t size);
+        void discardUploads(vk::Buffer buffer);
+
+        // Texture loaders size the staging buffer and write into its mapping, trailing bytes are left for the caller.
+        static TextureAsset::Allocator MakeTextureStagingAllocator(Vulkan::Buffer &staging_buffer, uint64_t trailing_size = 0);
+
+        void recordUploads(FrameGraph &frame_graph);
+#pragma endregion
+#pragma region Stream
+        void initializeStreaming(const Settings &settings);
+        void releaseStreaming();
+
+        // The levels above the resident tail stream in from the container as the shading asks for them, one level at
+        // a time and the smallest first.
+        void streamTexture(TextureID id, FileAsset file, bool is_ktx2, vk::Format format, const TextureAsset &tail_asset);
+        void stopTextureStream(TextureID id);
+
+        void requestStreamLevel(TextureID id);
+
+        // Runs on the stream thread, decoding requested levels straight into staging memory.
+        void runTextureStreamer(const std::stop_token &stop_token);
+
+        // Sized by texture ID, one slice per frame in flight. Growing it waits for the device.
+        void allocateTextureFeedbackBuffer(uint32_t texture_capacity);
+        void releaseTextureFeedbackBuffer();
+
+        [[nodiscard]] uint32_t getTextureFeedbackBase() const;
+
+        void readTextureFeedback();
+        void updateTextureResidency(std::vector<TextureRebuild> &rebuilds);
+
+        // Replaces the image with one holding the levels from mip_level on, the staging buffer brings the new first level.
+        void rebuildTexture(TextureID id, uint32_t mip_level, vk::Buffer staging_buffer, std::vector<TextureRebuild> &rebuilds);
+
+        [[nodiscard]] bool     canRebuildTexture(const StreamingTexture &streaming_texture) const;
+        [[nodiscard]] uint64_t getTextureMemoryLimit() const;
+
+        void recordTextureStreaming(FrameGraph &frame_graph);
+        void recordTextureFeedback(FrameGraph &frame_graph) const;
+#pragma endregion
+#pragma region Page
+        void initializePagePool(
+            PagePool               &pool,
+            uint64_t                element_size,
+            uint32_t                elements_per_page,
+            vk::BufferUsageFlags    usage,
+            vk::PipelineStageFlags2 stage_mask,
+            UploadStrategy          strategy,
+            vk::DescriptorSet       descriptor_set,
+            uint32_t                binding);
+        void releasePagePool(PagePool &pool);
+
+        uint32_t allocatePage(PagePool &pool);
+        void     freePage(PagePool &pool, uint32_t page);
+        void     reservePages(PagePool &pool, uint32_t element_count);
+
+        // Called once per frame after its fence, pages retired under this frame index are free again.
+        void recyclePages(PagePool &pool);
+
+        [[nodiscard]] vk::Buffer getPageBuffer(const PagePool &pool, uint32_t element) const;
+        [[nodiscard]] uint64_t   getPageOffset(const PagePool &pool, uint32_t element) const;
+
+        void readPagePool(const PagePool &pool, FrameGraph::RenderPass &render_pass) const;
+#pragma endregion
+#pragma region Geometry
+        void initializeGeometry(const Settings &settings);
+        void releaseGeometry();
+
+        void allocateGeometry(Model &model, uint32_t vertex_count, uint32_t index_count);
+        void freeGeometry(const GeometryAllocation &vertex_allocation, const GeometryAllocation &index_allocation);
+
+        void compactGeometry(uint32_t vertex_capacity, uint32_t index_capacity);
+
+        void readGeometryBuffers(FrameGraph::RenderPass &render_pass) const;
+#pragma endregion
+#pragma region Draw
+        void initializeDraws(const Settings &settings);
+        void releaseDraws();
+
+        void allocateDrawBuffers(uint32_t draw_capacity);
+        void releaseDrawBuffers();
+
+        void allocateVisibleInstanceBuffer(uint32_t instance_capacity);
+        void releaseVisibleInstanceBuffer();
+
+        void rebuildDraws();
+        void sortDraws();
+
+        double getDrawSortTime() const;
+
+        void readDrawBuffers(FrameGraph::RenderPass &render_pass) const;
+#pragma endregion
+#pragma region Cull
+        void initializeCulling(const Settings &settings);
+        void releaseCulling();
+
+        void setCullViewport(FrameGraph::ImageID depth_image);
+
+        void createDepthPyramid(const vk::Extent2D &depth_extent);
+        void releaseDepthPyramid();
+
+        void cullInstances();
+        void updateCullDrawOffsets();
+        void recordCulling(FrameGraph &frame_graph, CullPhase phase);
+        void recordDepthPyramid(FrameGraph &frame_graph);
+#pragma endregion
 #pragma region Skybox
         void initializeSkybox(const Settings &settings);
         void releaseSkybox();
@@ -257,9 +781,14 @@ namespace Ignis {
         TextureID addNormalTexture();
         TextureID addMetallicRoughnessTexture();
 
-        TextureID  addTexture(const Vulkan::Image &image, vk::ImageView view);
+        TextureID  addTexture(const Vulkan::Image &image, vk::ImageView view, uint32_t first_mip_level = 0);
         MaterialID addMaterial(const Material &material);
 
+        static uint32_t GetTextureSlot(TextureID id, uint32_t parity);
+
+        // Queued into the next upload pass, so it lands with the copies recorded before it.
+        void setTextureState(TextureID id, const TextureState &state);
+
         void removeTextureRC(TextureID id);
         void removeMaterialRC(MaterialID id);
 
@@ -269,76 +798,67 @@ namespace Ignis {
         void readMaterialBuffers(FrameGraph::RenderPass &render_pass) const;
 #pragma endregion
 #pragma region Light
-        void initializeLights();
+        void initializeLights(uint32_t max_binding_count);
         void releaseLights();
 
         void readLightBuffers(FrameGraph::RenderPass &render_pass);
+
+        void updateLightClusters();
+        void recordLightCulling(FrameGraph &frame_graph);
 #pragma endregion
 #pragma region Model
-        void initializeModels(uint32_t max_binding_count);
+        void initializeModels(const Settings &settings);
         void releaseModels();
 
         void setModelViewport(FrameGraph::ImageID color_image, FrameGraph::ImageID depth_image);
 
         void readModelBuffers(FrameGraph::RenderPass &render_pass);
 
-        void onModelDraw(vk::CommandBuffer command_buffer);
-
-        void setInstance(InstanceID id, const glm::mat4x4 &transform);
-
-        ModelID    addModel(const std::filesystem::path &path);
-        InstanceID addInstance(ModelID model_id, const glm::mat4x4 &transform);
-
-        void removeModel(ModelID id);
-        void removeInstance(InstanceID id);
-
-        std::string_view getModelPath(ModelID id);
+        void recordModelDepthPass(FrameGraph &frame_graph, vk::AttachmentLoadOp load_op);
+        void recordModelPass(FrameGraph &frame_graph, vk::AttachmentLoadOp load_op);
 
-        glm::mat4x4 getInstance(InstanceID id);
+        void createModelPipelines();
 
-        void processNode(
-            const std::filesystem::path &path,
+        void onModelDepthDraw(vk::CommandBuffer command_buffer);
+        void onModelDraw(vk::CommandBuffer command_buffer);
 
-            const aiScene     *ai_scene,
-            const aiNode      *ai_node,
-            const glm::mat4x4 &transform,
+        void setInstances(std::span<const InstanceID> ids, std::span<const glm::mat4x4> transforms);
 
-            std::vector<Vertex>   &vertices,
-            std::vector<uint32_t> &indices,
-            std::vector<Mesh>     &meshes,
+        ModelID                 addModel(const std::filesystem::path &path);
+        std::vector<InstanceID> addInstances(ModelID model_id, std::span<const glm::mat4x4> transforms);
 
-            std::vector<vk::DrawIndexedIndirectCommand> &indirect_commands);
+        void removeModel(ModelID id);
+        void removeInstances(std::span<const InstanceID> ids);
 
-        void processMesh(
-            const std::filesystem::path &path,
+        void reserveInstances(ModelID model_id, uint32_t instance_count);
+        void trimInstances(ModelID model_id);
+        void uploadInstances(ModelID model_id, uint32_t first_index, uint32_t last_index);
+        void updateIndirectInstanceCounts(ModelID model_id);
 
-            const aiScene     *ai_scene,
-            const aiMesh      *ai_mesh,
-            const glm::mat4x4 &transform,
+        std::string_view getModelPath(ModelID id);
 
-            std::vector<Vertex>   &vertices,
-            std::vector<uint32_t> &indices,
-            std::vector<Mesh>     &meshes,
+        const Model &getModel(ModelID id);
+        Mesh         getMesh(MeshID id);
+        glm::mat4x4  getInstance(InstanceID id);
 
-            std::vector<vk::DrawIndexedIndirectCommand> &indirect_commands);
+        std::optional<CookedModel> loadModel(const std::filesystem::path &path);
 
         MaterialID processMaterial(
             const std::filesystem::path &path,
+            const CookedModel           &cooked_model,
 
-            const aiScene    *ai_scene,
-            const aiMaterial *ai_material,
+            uint32_t material_index,
 
-            uint32_t ai_material_index);
+            const gtl::flat_hash_map<uint64_t, TextureID> &texture_ids);
 
-        TextureID processTexture(
+        // Runs on the import jobs, it only reads the renderer while the render thread waits on them.
+        void prepareTexture(
             const std::filesystem::path &directory,
+            const CookedModel           &cooked_model,
 
-            const aiScene    *ai_scene,
-            const aiMaterial *ai_material,
-
-            aiTextureType ai_texture_type,
+            PreparedTexture &texture) const;
 
-            bool is_srgb = true);
+        TextureID uploadTexture(PreparedTexture &texture);
 #pragma endregion
 
        private:
@@ -349,10 +869,133 @@ namespace Ignis {
 
         vk::DescriptorPool m_DescriptorPool = nullptr;
 
-        vk::Sampler m_Sampler = nullptr;
+        vk::Sampler m_Sampler        = nullptr;
+        vk::Sampler m_TextureSampler = nullptr;
 
         Camera m_Camera{};
 
+        std::optional<AssetDatabase> m_AssetDatabase = std::nullopt;
+
+#pragma region Upload
+        std::vector<Vulkan::Buffer> m_UploadStagingBuffers{};
+
+        std::vector<PendingUpload> m_PendingUploads{};
+        std::vector<std::byte>     m_PendingUploadData{};
+#pragma endregion
+#pragma region Stream
+        uint64_t m_TextureStreamingBudget     = 0;
+        uint32_t m_TextureStreamingTailExtent = ~0u;
+        uint64_t m_TextureMemoryBudget        = 0;
+
+        uint64_t m_NextStreamSerial = 0;
+
+        // Counts recorded frames, feedback and rebuilds are stamped with it.
+        uint64_t m_ResidencyFrame = 0;
+
+        gtl::flat_hash_map<TextureID, StreamingTexture> m_StreamingTextures{};
+
+        // The images of streamed textures, the only texture memory residency can give back.
+        uint64_t m_StreamedTextureMemory = 0;
+
+        // Mip levels the model pass asked for by texture ID, ~0u for textures it did not sample.
+        Vulkan::Buffer m_TextureFeedbackBuffer{};
+        uint32_t       m_TextureFeedbackCapacity = 0;
+
+        // Indexed by frame in flight, destroyed once that frame's fence has been waited on.
+        std::vector<StreamRetirement> m_StreamRetirements{};
+
+        // Shared with the stream thread.
+        std::mutex                  m_StreamMutex{};
+        std::condition_variable_any m_StreamCondition{};
+        std::deque<StreamRequest>   m_StreamRequests{};
+        std::deque<StreamResult>    m_StreamResults{};
+        uint64_t                    m_StreamResultSize = 0;
+
+        std::jthread m_StreamThread{};
+#pragma endregion
+#pragma region Geometry
+        Vulkan::Buffer m_VertexBuffer{};
+        Vulkan::Buffer m_IndexBuffer{};
+
+        vma::VirtualBlock m_VertexBlock = nullptr;
+        vma::VirtualBlock m_IndexBlock  = nullptr;
+
+        FrameGraph::BufferInfo m_FrameGraphVertexBuffer{};
+        FrameGraph::BufferInfo m_FrameGraphIndexBuffer{};
+#pragma endregion
+#pragma region Draw
+        std::vector<vk::DrawIndexedIndirectCommand> m_DrawCommands{};
+        std::vector<DrawRecord>                     m_DrawRecords{};
+        std::vector<MaterialDrawRange>              m_MaterialDrawRanges{};
+
+        // Indexed by draw in model order, the order rebuildDraws lays the draws out in.
+        std::vector<uint64_t> m_DrawKeyBases{};
+        std::vector<uint32_t> m_DrawSlots{};
+
+        std::vector<uint64_t>                       m_DrawSortKeys{};
+        std::vector<uint64_t>                       m_DrawSortScratch{};
+        std::vector<vk::DrawIndexedIndirectCommand> m_SortedDrawCommands{};
+        std::vector<DrawRecord>                     m_SortedDrawRecords{};
+
+        bool m_DrawOrderDirty = false;
+
+        Timer  m_DrawSortTimer{};
+        double m_DrawSortTime = 0.0;
+
+        uint32_t m_DrawCapacity            = 0;
+        uint32_t m_VisibleInstanceCapacity = 0;
+
+        // Prefix sums of the sorted draw instance counts, the GPU cull dispatch runs one thread per instance.
+        std::vector<uint32_t> m_CullDrawOffsets{};
+
+        uint32_t m_CullInstanceCount    = 0;
+        bool     m_CullDrawOffsetsDirty = false;
+
+        Vulkan::Buffer m_DrawCommandBuffer{};
+        Vulkan::Buffer m_DrawRecordBuffer{};
+        Vulkan::Buffer m_CullDrawOffsetBuffer{};
+        Vulkan::Buffer m_DrawCountBuffer{};
+        Vulkan::Buffer m_CulledDrawCommandBuffer{};
+        Vulkan::Buffer m_VisibleInstanceBuffer{};
+        Vulkan::Buffer m_InstanceVisibilityBuffer{};
+
+        FrameGraph::BufferInfo m_FrameGraphDrawCommandBuffer{};
+        FrameGraph::BufferInfo m_FrameGraphDrawRecordBuffer{};
+        FrameGraph::BufferInfo m_FrameGraphCullDrawOffsetBuffer{};
+        FrameGraph::BufferInfo m_FrameGraphDrawCountBuffer{};
+        FrameGraph::BufferInfo m_FrameGraphCulledDrawCommandBuffer{};
+        FrameGraph::BufferInfo m_FrameGraphVisibleInstanceBuffer{};
+        FrameGraph::BufferInfo m_FrameGraphInstanceVisibilityBuffer{};
+#pragma endregion
+#pragma region Cull
+        CullingMode m_CullingMode{CullingMode::eGPU};
+
+        std::vector<CullChunk>                      m_CullChunks{};
+        std::vector<uint32_t>                       m_CulledInstances{};
+        std::vector<vk::DrawIndexedIndirectCommand> m_CulledDrawCommands{};
+
+        vk::PipelineLayout m_CullPipelineLayout = nullptr;
+
+        vk::Pipeline m_CullResetPipeline = nullptr;
+        vk::Pipeline m_CullPipeline      = nullptr;
+
+        bool m_OcclusionCulling = false;
+
+        vk::DescriptorSetLayout m_DepthPyramidDescriptorLayout = nullptr;
+
+        vk::DescriptorSet m_DepthPyramidDescriptorSet = nullptr;
+
+        vk::PipelineLayout m_DepthPyramidPipelineLayout = nullptr;
+
+        vk::Pipeline m_DepthPyramidPipeline       = nullptr;
+        vk::Pipeline m_DepthPyramidReducePipeline = nullptr;
+
+        Vulkan::Image              m_DepthPyramidImage{};
+        vk::ImageView              m_DepthPyramidView = nullptr;
+        std::vector<vk::ImageView> m_DepthPyramidMipViews{};
+
+        FrameGraph::ImageID m_FrameGraphDepthPyramid{FrameGraph::k_InvalidImageID};
+#pragma endregion
 #pragma region Skybox
         vk::DescriptorSetLayout m_SkyboxDescriptorLayout = nullptr;
         vk::DescriptorSet       m_SkyboxDescriptorSet    = nullptr;
@@ -396,6 +1039,9 @@ namespace Ignis {
         TextureID  m_NextTextureID{k_InvalidTextureID};
         MaterialID m_NextMaterialID{k_InvalidMaterialID};
 
+        // Slots in the texture binding, every texture takes two of them.
+        uint32_t m_TextureSlotCount = 0;
+
         std::vector<TextureID>  m_FreeTextureIDs{};
         std::vector<MaterialID> m_FreeMaterialIDs{};
 
@@ -404,21 +1050,24 @@ namespace Ignis {
 
         gtl::flat_hash_set<MaterialID> m_Materials{};
 
+        gtl::flat_hash_map<MaterialID, uint32_t> m_MaterialFeatures{};
+
         Vulkan::Buffer m_MaterialStagingBuffer{};
-        Vulkan::Buffer m_MaterialBuffer{};
 
-        SparseVector<TextureID, FrameGraph::ImageID> m_FrameGraphImages{};
+        PagePool m_TexturePages{};
+        PagePool m_MaterialPages{};
 
-        FrameGraph::BufferInfo m_FrameGraphMaterialBuffer{};
+        SparseVector<TextureID, FrameGraph::ImageID> m_FrameGraphImages{};
 
         gtl::flat_hash_map<std::string, MaterialID> m_LoadedMaterials{};
+        // Keyed by the content hash and variant of a texture, or by the cook path that already encodes both.
         gtl::flat_hash_map<std::string, TextureID>  m_LoadedTextures{};
 
         gtl::flat_hash_map<MaterialID, uint32_t> m_LoadedMaterialRCs{};
         gtl::flat_hash_map<TextureID, uint32_t>  m_LoadedTextureRCs{};
 
         gtl::flat_hash_map<MaterialID, std::string> m_LoadedMaterialPaths{};
-        gtl::flat_hash_map<TextureID, std::string>  m_LoadedTexturePaths{};
+        gtl::flat_hash_map<TextureID, std::string>  m_LoadedTextureKeys{};
 #pragma endregion
 #pragma region Light
         vk::DescriptorSetLayout m_LightDescriptorLayout = nullptr;
@@ -445,14 +1094,25 @@ namespace Ignis {
         Vulkan::Buffer m_SpotLightStagingBuffer{};
 
         Vulkan::Buffer m_DirectionalLightBuffer{};
-        Vulkan::Buffer m_PointLightBuffer{};
-        Vulkan::Buffer m_SpotLightBuffer{};
         Vulkan::Buffer m_LightDataBuffer{};
 
+        PagePool m_PointLightPages{};
+        PagePool m_SpotLightPages{};
+
         FrameGraph::BufferInfo m_FrameGraphDirectionalLightBuffer{};
-        FrameGraph::BufferInfo m_FrameGraphPointLightBuffer{};
-        FrameGraph::BufferInfo m_FrameGraphSpotLightBuffer{};
         FrameGraph::BufferInfo m_FrameGraphLightDataBuffer{};
+
+        Vulkan::Buffer m_ClusterDataBuffer{};
+        Vulkan::Buffer m_ClusterGridBuffer{};
+        Vulkan::Buffer m_ClusterLightIndexBuffer{};
+
+        FrameGraph::BufferInfo m_FrameGraphClusterDataBuffer{};
+        FrameGraph::BufferInfo m_FrameGraphClusterGridBuffer{};
+        FrameGraph::BufferInfo m_FrameGraphClusterLightIndexBuffer{};
+
+        vk::PipelineLayout m_LightCullPipelineLayout = nullptr;
+
+        vk::Pipeline m_LightCullPipeline = nullptr;
 #pragma endregion
 #pragma region Model
         vk::DescriptorSetLayout m_ModelDescriptorLayout = nullptr;
@@ -461,7 +1121,20 @@ namespace Ignis {
 
         vk::PipelineLayout m_ModelPipelineLayout = nullptr;
 
-        vk::Pipeline m_ModelPipeline = nullptr;
+        gtl::flat_hash_map<uint32_t, vk::Pipeline> m_ModelPipelines{};
+
+        vk::Pipeline m_ModelDepthPipeline = nullptr;
+
+        vk::Format m_ModelColorFormat{vk::Format::eUndefined};
+        vk::Format m_ModelDepthFormat{vk::Format::eUndefined};
+
+        bool m_DepthPrePass     = false;
+        bool m_CompressTextures = true;
+
+        // Block compressed containers are skipped without it, their materials fall back to the default maps.
+        bool m_SupportsBlockCompression = true;
+
+        UploadStrategy m_InstanceUploadStrategy{UploadStrategy::eReBAR};
 
         MeshID     m_NextMeshID{k_InvalidMeshID};
         InstanceID m_NextInstanceID{k_InvalidInstanceID};
@@ -479,11 +1152,10 @@ namespace Ignis {
         gtl::flat_hash_map<MeshID, ModelID>     m_MeshToModel{};
         gtl::flat_hash_map<InstanceID, ModelID> m_InstanceToModel{};
 
-        SparseVector<ModelID, FrameGraph::BufferInfo> m_FrameGraphModelVertexBuffers{};
-        SparseVector<ModelID, FrameGraph::BufferInfo> m_FrameGraphModelIndexBuffers{};
+        PagePool m_InstancePages{};
+
         SparseVector<ModelID, FrameGraph::BufferInfo> m_FrameGraphModelMeshBuffers{};
-        SparseVector<ModelID, FrameGraph::BufferInfo> m_FrameGraphModelInstanceBuffers{};
-        SparseVector<ModelID, FrameGraph::BufferInfo> m_FrameGraphModelIndirectBuffers{};
+        SparseVector<ModelID, FrameGraph::BufferInfo> m_FrameGraphModelInstancePageTables{};
 
         gtl::flat_hash_map<std::string, ModelID> m_LoadedModels{};
 #pragma endregion
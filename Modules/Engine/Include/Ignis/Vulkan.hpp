@@ -340,6 +340,7 @@ namespace Ignis {
 
             GraphicsPipelineBuilder &setVertexShader(std::string_view entry_point, vk::ShaderModule module);
             GraphicsPipelineBuilder &setFragmentShader(std::string_view entry_point, vk::ShaderModule module);
+            GraphicsPipelineBuilder &setSpecializationConstant(vk::ShaderStageFlagBits stage, uint32_t constant_id, uint32_t value);
             GraphicsPipelineBuilder &setVertexLayouts(const vk::ArrayProxy<VertexLayout> &vertex_layouts);
             GraphicsPipelineBuilder &setInputTopology(vk::PrimitiveTopology topology);
             GraphicsPipelineBuilder &setPolygonMode(vk::PolygonMode polygon_mode);
@@ -362,6 +363,9 @@ namespace Ignis {
                 std::string             EntryPoint;
                 vk::ShaderModule        Module;
                 vk::ShaderStageFlagBits Stage;
+
+                std::vector<vk::SpecializationMapEntry> SpecializationEntries;
+                std::vector<uint32_t>                   SpecializationData;
             };
 
            private:
@@ -435,6 +439,11 @@ namespace Ignis {
         static vma::AllocationInfo GetAllocationInfo(const vma::Allocation &allocation);
         static vma::AllocationInfo GetAllocationInfo(const Buffer &buffer);
 
+        static vk::MemoryPropertyFlags GetAllocationMemoryProperties(const vma::Allocation &allocation);
+
+        // The budget of the heap the allocation lives in, VMA estimates it when VK_EXT_memory_budget is missing.
+        static vma::Budget GetAllocationHeapBudget(const vma::Allocation &allocation);
+
 #pragma region Buffer
         static void DestroyBuffer(const Buffer &buffer);
 
@@ -444,6 +453,10 @@ namespace Ignis {
             vk::BufferCreateFlags      buffer_flags,
             uint64_t                   size,
             vk::BufferUsageFlags       usage_flags);
+
+        static void DestroyVirtualBlock(vma::VirtualBlock virtual_block);
+
+        static vma::VirtualBlock CreateVirtualBlock(uint64_t size);
 #pragma endregion
 #pragma region Command
         static void DestroyCommandPool(vk::CommandPool command_pool);
@@ -502,6 +515,14 @@ namespace Ignis {
             const vk::Extent2D &extent,
             vk::CommandBuffer   command_buffer);
 
+        static void GenerateImage2DMipLevels(
+            vk::Image           image,
+            vk::ImageLayout     old_layout,
+            vk::ImageLayout     new_layout,
+            uint32_t            mip_level_count,
+            const vk::Extent2D &extent,
+            vk::CommandBuffer   command_buffer);
+
         static void CopyImageToImage(
             vk::Image           src_image,
             vk::Image           dst_image,
@@ -509,6 +530,14 @@ namespace Ignis {
             const vk::Offset3D &dst_offset,
             const vk::Extent3D &extent,
             vk::CommandBuffer   command_buffer);
+        static void CopyImageToImage(
+            vk::Image           src_image,
+            vk::Image           dst_image,
+            uint32_t            src_mip_level,
+            uint32_t            dst_mip_level,
+            uint32_t            layer_count,
+            const vk::Extent3D &extent,
+            vk::CommandBuffer   command_buffer);
         static void CopyBufferToBuffer(
             vk::Buffer        src_buffer,
             vk::Buffer        dst_buffer,
@@ -516,6 +545,11 @@ namespace Ignis {
             uint64_t          dst_offset,
             uint64_t          size,
             vk::CommandBuffer command_buffer);
+        static void CopyBufferToBuffer(
+            vk::Buffer                             src_buffer,
+            vk::Buffer                             dst_buffer,
+            const vk::ArrayProxy<vk::BufferCopy2> &regions,
+            vk::CommandBuffer                      command_buffer);
         static void CopyBufferToImage(
             vk::Buffer          src_buffer,
             vk::Image           dst_image,
@@ -524,6 +558,25 @@ namespace Ignis {
             const vk::Extent2D &src_extent,
             const vk::Extent3D &dst_extent,
             vk::CommandBuffer   command_buffer);
+        static void CopyBufferToImage(
+            vk::Buffer          src_buffer,
+            vk::Image           dst_image,
+            uint32_t            dst_mip_level,
+            uint64_t            src_offset,
+            const vk::Offset3D &dst_offset,
+            const vk::Extent2D &src_extent,
+            const vk::Extent3D &dst_extent,
+            vk::CommandBuffer   command_buffer);
+        static void CopyBufferToImage(
+            vk::Buffer          src_buffer,
+            vk::Image           dst_image,
+            uint32_t            dst_mip_level,
+            uint32_t            dst_layer_count,
+            uint64_t            src_offset,
+            const vk::Offset3D &dst_offset,
+            const vk::Extent2D &src_extent,
+            const vk::Extent3D &dst_extent,
+            vk::CommandBuffer   command_buffer);
         static void CopyImageToBuffer(
             vk::Image           src_image,
             vk::Buffer          dst_buffer,
@@ -606,6 +659,33 @@ namespace Ignis {
             vk::ImageUsageFlags        usage_flags,
             const vk::Extent3D        &extent);
 
+        static Image AllocateImage2DArray(
+            vma::AllocationCreateFlags allocation_flags,
+            vma::MemoryUsage           memory_usage,
+            vk::ImageCreateFlagBits    image_flags,
+            vk::Format                 format,
+            vk::ImageUsageFlags        usage_flags,
+            uint32_t                   mip_level_count,
+            uint32_t                   layer_count,
+            const vk::Extent2D        &extent);
+
+        static Image AllocateImage2DWithMipLevels(
+            vma::AllocationCreateFlags allocation_flags,
+            vma::MemoryUsage           memory_usage,
+            vk::ImageCreateFlagBits    image_flags,
+            vk::Format                 format,
+            vk::ImageUsageFlags        usage_flags,
+            const vk::Extent2D        &extent);
+
+        static Image AllocateImage2D(
+            vma::AllocationCreateFlags allocation_flags,
+            vma::MemoryUsage           memory_usage,
+            vk::ImageCreateFlagBits    image_flags,
+            vk::Format                 format,
+            vk::ImageUsageFlags        usage_flags,
+            uint32_t                   mip_level_count,
+            const vk::Extent2D        &extent);
+
         static Image AllocateImage2D(
             vma::AllocationCreateFlags allocation_flags,
             vma::MemoryUsage           memory_usage,
@@ -624,6 +704,8 @@ namespace Ignis {
         static vk::ImageView CreateImageDepthView2DArray(vk::Image image, vk::Format format, uint32_t base_layer, uint32_t layer_count);
 
         static vk::ImageView CreateImageColorView2D(vk::Image image, vk::Format format, uint32_t base_layer, uint32_t layer_count);
+
+        static vk::ImageView CreateImageColorView2DWithMipLevels(vk::Image image, vk::Format format, uint32_t base_mip_level, uint32_t mip_level_count);
         static vk::ImageView CreateImageDepthView2D(vk::Image image, vk::Format format, uint32_t base_layer, uint32_t layer_count);
 
         static vk::ImageView CreateImageColorViewCube(vk::Image image, vk::Format format, uint32_t base_mip_level, uint32_t mip_level_count);
@@ -747,6 +829,7 @@ namespace Ignis {
 
        private:
         static bool CheckInstanceLayerSupport(const std::vector<const char *> &required_instance_layers);
+        static bool CheckPhysicalDeviceExtensionSupport(vk::PhysicalDevice physical_device, const char *extension_name);
         static bool CheckPhysicalDeviceSwapchainSupport(
             vk::PhysicalDevice  physical_device,
             vk::SurfaceKHR      surface,
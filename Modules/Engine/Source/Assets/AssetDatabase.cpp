@@ -0,0 +1,254 @@
+#include <Ignis/Assets/AssetDatabase.hpp>
+#include <Ignis/Assets/FileAsset.hpp>
+#include <Ignis/Assets/VirtualFileSystem.hpp>
+
+namespace Ignis {
+    constexpr std::string_view k_ManifestHeader = "IgnisAssetDatabase";
+
+    std::vector<std::string_view> SplitManifestLine(std::string_view line);
+
+    int64_t GetWriteTime(const std::filesystem::path &path);
+
+    std::optional<AssetDatabase> AssetDatabase::Open(const std::filesystem::path &root_directory, const std::filesystem::path &cache_directory) {
+        const std::filesystem::path manifest_path = cache_directory / k_ManifestName;
+
+        // Only the cooker writes the cache, a packed one needs no directory on disk.
+        std::error_code error{};
+        if (!VirtualFileSystem::IsMounted(manifest_path))
+            std::filesystem::create_directories(cache_directory, error);
+        if (error) {
+            DIGNIS_LOG_ENGINE_WARN("Failed to create the asset cache directory: '{}'. Error: '{}'", cache_directory.string(), error.message());
+            return std::nullopt;
+        }
+
+        AssetDatabase asset_database{};
+        asset_database.m_RootDirectory  = root_directory;
+        asset_database.m_CacheDirectory = cache_directory;
+
+        if (!VirtualFileSystem::Exists(manifest_path))
+            return asset_database;
+
+        // A packed cache serves its manifest from the pak like every cooked file.
+        const std::optional<FileAsset> manifest = FileAsset::LoadTextFromPath(manifest_path);
+        if (!manifest.has_value()) {
+            DIGNIS_LOG_ENGINE_WARN("Failed to open the asset manifest: '{}'", manifest_path.string());
+            return std::nullopt;
+        }
+
+        std::vector<std::string_view> lines{};
+        for (const auto line : std::views::split(manifest->getContent(), '\n')) {
+            std::string_view manifest_line{std::begin(line), std::end(line)};
+            if (manifest_line.ends_with('\r'))
+                manifest_line.remove_suffix(1);
+            lines.push_back(manifest_line);
+        }
+
+        // An outdated manifest only costs a full cook, so it is dropped instead of migrated.
+        if (const std::vector<std::string_view> header = SplitManifestLine(lines.empty() ? std::string_view{} : lines[0]);
+            2 != header.size() || k_ManifestHeader != header[0] || std::to_string(k_ManifestVersion) != header[1]) {
+            DIGNIS_LOG_ENGINE_WARN("Ignoring an asset manifest of another version: '{}'", manifest_path.string());
+            return asset_database;
+        }
+
+        Entry *entry = nullptr;
+        for (const std::string_view line : lines | std::views::drop(1)) {
+            const std::vector<std::string_view> fields = SplitManifestLine(line);
+
+            if (5 == fields.size() && "E" == fields[0]) {
+                Entry new_entry{};
+                std::from_chars(fields[2].data(), fields[2].data() + fields[2].size(), new_entry.Hash, 16);
+                new_entry.Extension = fields[3];
+
+                entry = &asset_database.m_Entries.insert_or_assign(std::string{fields[1]}, new_entry).first->second;
+            } else if (5 == fields.size() && "D" == fields[0] && nullptr != entry) {
+                Dependency dependency{};
+                dependency.Path = fields[1];
+                std::from_chars(fields[2].data(), fields[2].data() + fields[2].size(), dependency.Size);
+                std::from_chars(fields[3].data(), fields[3].data() + fields[3].size(), dependency.WriteTime);
+                std::from_chars(fields[4].data(), fields[4].data() + fields[4].size(), dependency.Hash, 16);
+
+                entry->Dependencies.push_back(dependency);
+            } else if (!line.empty()) {
+                DIGNIS_LOG_ENGINE_WARN("Skipping a malformed asset manifest line: '{}'", line);
+            }
+        }
+
+        DIGNIS_LOG_ENGINE_INFO("Loaded an Ignis::AssetDatabase with {} entries from: '{}'", asset_database.m_Entries.size(), manifest_path.string());
+
+        return asset_database;
+    }
+
+    uint64_t AssetDatabase::HashBytes(const void *data, const size_t size, const uint64_t seed) {
+        return XXH3_64bits_withSeed(data, size, seed);
+    }
+
+    std::optional<uint64_t> AssetDatabase::HashFile(const std::filesystem::path &path) {
+        // The mapping is read front to back once, which is the access pattern it is advised for.
+        const std::optional<FileAsset> file = FileAsset::LoadBinaryFromPath(path);
+        if (!file.has_value()) {
+            DIGNIS_LOG_ENGINE_WARN("Failed to open a file for hashing: '{}'", path.string());
+            return std::nullopt;
+        }
+
+        return HashBytes(file->getBytes().data(), file->getSize());
+    }
+
+    bool AssetDatabase::save() const {
+        const std::filesystem::path manifest_path = m_CacheDirectory / k_ManifestName;
+
+        // Sorted keys keep the manifest stable between cooks.
+        std::vector<const std::string *> keys{};
+        keys.reserve(m_Entries.size());
+        for (const std::string &key : std::views::keys(m_Entries))
+            keys.push_back(&key);
+        std::ranges::sort(keys, [](const std::string *lhs, const std::string *rhs) {
+            return *lhs < *rhs;
+        });
+
+        std::ofstream ofile{manifest_path, std::ios::trunc};
+        if (!ofile.is_open()) {
+            DIGNIS_LOG_ENGINE_WARN("Failed to open the asset manifest for writing: '{}'", manifest_path.string());
+            return false;
+        }
+
+        ofile << k_ManifestHeader << '\t' << k_ManifestVersion << '\n';
+
+        for (const std::string *key : keys) {
+            const Entry &entry = m_Entries.at(*key);
+
+            ofile << FormatString("E\t{}\t{:016x}\t{}\t{}\n", *key, entry.Hash, entry.Extension, entry.Dependencies.size());
+            for (const Dependency &dependency : entry.Dependencies)
+                ofile << FormatString("D\t{}\t{}\t{}\t{:016x}\n", dependency.Path, dependency.Size, dependency.WriteTime, dependency.Hash);
+        }
+
+        ofile.close();
+
+        return true;
+    }
+
+    std::string AssetDatabase::getKey(const std::filesystem::path &source_path, const std::string_view variant) const {
+        std::string key = std::filesystem::proximate(source_path, m_RootDirectory).generic_string();
+        if (!variant.empty())
+            key = FormatString("{}#{}", key, variant);
+        return key;
+    }
+
+    std::optional<AssetDatabase::Dependency> AssetDatabase::getDependency(const std::filesystem::path &path) const {
+        std::error_code error{};
+
+        const uint64_t size = std::filesystem::file_size(path, error);
+        if (error) {
+            DIGNIS_LOG_ENGINE_WARN("Failed to find an asset dependency: '{}'", path.string());
+            return std::nullopt;
+        }
+
+        const std::optional<uint64_t> hash = HashFile(path);
+        if (!hash.has_value())
+            return std::nullopt;
+
+        Dependency dependency{};
+        dependency.Path      = getKey(path);
+        dependency.Size      = size;
+        dependency.WriteTime = GetWriteTime(path);
+        dependency.Hash      = hash.value();
+
+        return dependency;
+    }
+
+    const AssetDatabase::Entry *AssetDatabase::findEntry(const std::string &key) const {
+        const auto it = m_Entries.find(key);
+        return std::end(m_Entries) != it ? &it->second : nullptr;
+    }
+
+    std::optional<std::filesystem::path> AssetDatabase::findCooked(const std::filesystem::path &source_path, const std::string_view variant) const {
+        const Entry *entry = findEntry(getKey(source_path, variant));
+        if (nullptr == entry || !isCurrent(*entry))
+            return std::nullopt;
+
+        std::filesystem::path cooked_path = getCookedPath(*entry);
+        if (!VirtualFileSystem::Exists(cooked_path))
+            return std::nullopt;
+
+        return cooked_path;
+    }
+
+    bool AssetDatabase::isCurrent(const Entry &entry) const {
+        for (const Dependency &dependency : entry.Dependencies) {
+            const std::filesystem::path path = m_RootDirectory / dependency.Path;
+
+            std::error_code error{};
+
+            const uint64_t size = std::filesystem::file_size(path, error);
+            if (error)
+                continue;
+
+            // Touched files are hashed again, only a change of content makes an entry stale.
+            if (size == dependency.Size && GetWriteTime(path) == dependency.WriteTime)
+                continue;
+
+            if (size != dependency.Size || HashFile(path) != dependency.Hash)
+                return false;
+        }
+
+        return true;
+    }
+
+    void AssetDatabase::setEntry(const std::string &key, const Entry &entry) {
+        m_Entries.insert_or_assign(key, entry);
+    }
+
+    void AssetDatabase::removeEntry(const std::string &key) {
+        m_Entries.erase(key);
+    }
+
+    uint32_t AssetDatabase::removeUnreferenced() const {
+        gtl::flat_hash_set<std::string> referenced{};
+        for (const Entry &entry : std::views::values(m_Entries))
+            referenced.insert(getCookedPath(entry).filename().string());
+
+        uint32_t removed_count = 0;
+
+        std::error_code error{};
+        for (const std::filesystem::directory_entry &directory_entry : std::filesystem::directory_iterator{m_CacheDirectory, error}) {
+            if (!directory_entry.is_regular_file())
+                continue;
+
+            const std::string filename = directory_entry.path().filename().string();
+            if (k_ManifestName == filename || referenced.contains(filename))
+                continue;
+
+            if (std::filesystem::remove(directory_entry.path(), error))
+                removed_count++;
+        }
+
+        return removed_count;
+    }
+
+    std::filesystem::path AssetDatabase::getCookedPath(const Entry &entry) const {
+        return m_CacheDirectory / FormatString("{:016x}{}", entry.Hash, entry.Extension);
+    }
+
+    const std::filesystem::path &AssetDatabase::getRootDirectory() const {
+        return m_RootDirectory;
+    }
+
+    const std::filesystem::path &AssetDatabase::getCacheDirectory() const {
+        return m_CacheDirectory;
+    }
+
+    const gtl::flat_hash_map<std::string, AssetDatabase::Entry> &AssetDatabase::getEntries() const {
+        return m_Entries;
+    }
+
+    std::vector<std::string_view> SplitManifestLine(const std::string_view line) {
+        std::vector<std::string_view> fields{};
+        for (const auto field : std::views::split(line, '\t'))
+            fields.emplace_back(std::begin(field), std::end(field));
+        return fields;
+    }
+
+    int64_t GetWriteTime(const std::filesystem::path &path) {
+        std::error_code error{};
+        return static_cast<int64_t>(std::filesystem::last_write_time(path, error).time_since_epoch().count());
+    }
+}  // namespace Ignis
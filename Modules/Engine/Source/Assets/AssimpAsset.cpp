@@ -1,15 +1,18 @@
 #include <Ignis/Assets/AssimpAsset.hpp>
+#include <Ignis/Assets/VirtualFileSystem.hpp>
 
 namespace Ignis {
     std::optional<std::unique_ptr<AssimpAsset>> AssimpAsset::LoadFromPath(const std::filesystem::path &path) {
         const std::string spath = path.string();
 
-        if (!std::filesystem::exists(path)) {
+        if (!VirtualFileSystem::Exists(path)) {
             DIGNIS_LOG_ENGINE_WARN("Failed to find an assimp asset from path: '{}'", spath);
             return std::nullopt;
         }
 
         auto asset = std::make_unique<AssimpAsset>();
+        // The importer owns its IO system.
+        asset->m_Importer.SetIOHandler(new VirtualIOSystem{});
 
         if (nullptr == asset->m_Importer.ReadFile(
                            spath,
@@ -0,0 +1,286 @@
+#include <Ignis/Assets/BlockCompressor.hpp>
+
+namespace Ignis {
+    template <glm::length_t L>
+    using Texels = std::array<glm::vec<L, glm::f32>, BlockCompressor::k_BlockTexelCount>;
+
+    template <glm::length_t L>
+    std::pair<glm::vec<L, glm::f32>, glm::vec<L, glm::f32>> FindEndpoints(const Texels<L> &texels);
+
+    void EncodeBC4Channel(const std::array<uint8_t, BlockCompressor::k_BlockTexelCount> &values, std::span<uint8_t, 8> output);
+
+    uint16_t  PackRGB565(const glm::vec3 &color);
+    glm::vec3 UnpackRGB565(uint16_t color);
+
+    class BlockBitWriter {
+       public:
+        void write(const uint32_t value, const uint32_t bit_count) {
+            for (uint32_t i = 0; i < bit_count; i++, m_Position++)
+                m_Bytes[m_Position / 8] |= static_cast<uint8_t>(((value >> i) & 1u) << (m_Position % 8));
+        }
+
+        const std::array<uint8_t, 16> &getBytes() const {
+            return m_Bytes;
+        }
+
+       private:
+        std::array<uint8_t, 16> m_Bytes{};
+
+        uint32_t m_Position = 0;
+    };
+
+    void BlockCompressor::EncodeBC1(const Block &block, const std::span<uint8_t, 8> output) {
+        Texels<3> texels{};
+        for (uint32_t i = 0; i < k_BlockTexelCount; i++)
+            texels[i] = glm::vec3{block[i]};
+
+        const auto [low, high] = FindEndpoints<3>(texels);
+
+        uint16_t color0 = PackRGB565(high);
+        uint16_t color1 = PackRGB565(low);
+
+        // color0 > color1 selects the four color mode, equal endpoints need no indices at all.
+        if (color0 < color1)
+            std::swap(color0, color1);
+
+        uint32_t indices = 0;
+
+        if (color0 != color1) {
+            const glm::vec3 color0_rgb = UnpackRGB565(color0);
+            const glm::vec3 color1_rgb = UnpackRGB565(color1);
+
+            const std::array<glm::vec3, 4> palette{
+                color0_rgb,
+                color1_rgb,
+                (2.0f * color0_rgb + color1_rgb) / 3.0f,
+                (color0_rgb + 2.0f * color1_rgb) / 3.0f,
+            };
+
+            for (uint32_t i = 0; i < k_BlockTexelCount; i++) {
+                uint32_t best_index    = 0;
+                glm::f32 best_distance = std::numeric_limits<glm::f32>::max();
+
+                for (uint32_t j = 0; j < palette.size(); j++) {
+                    const glm::vec3 delta    = texels[i] - palette[j];
+                    const glm::f32  distance = glm::dot(delta, delta);
+                    if (distance < best_distance) {
+                        best_index    = j;
+                        best_distance = distance;
+                    }
+                }
+
+                indices |= best_index << (2 * i);
+            }
+        }
+
+        output[0] = static_cast<uint8_t>(color0);
+        output[1] = static_cast<uint8_t>(color0 >> 8);
+        output[2] = static_cast<uint8_t>(color1);
+        output[3] = static_cast<uint8_t>(color1 >> 8);
+        output[4] = static_cast<uint8_t>(indices);
+        output[5] = static_cast<uint8_t>(indices >> 8);
+        output[6] = static_cast<uint8_t>(indices >> 16);
+        output[7] = static_cast<uint8_t>(indices >> 24);
+    }
+
+    void BlockCompressor::EncodeBC4(const Block &block, const std::span<uint8_t, 8> output) {
+        std::array<uint8_t, k_BlockTexelCount> values{};
+        for (uint32_t i = 0; i < k_BlockTexelCount; i++)
+            values[i] = block[i].r;
+
+        EncodeBC4Channel(values, output);
+    }
+
+    void BlockCompressor::EncodeBC5(const Block &block, const std::span<uint8_t, 16> output) {
+        std::array<uint8_t, k_BlockTexelCount> reds{};
+        std::array<uint8_t, k_BlockTexelCount> greens{};
+        for (uint32_t i = 0; i < k_BlockTexelCount; i++) {
+            reds[i]   = block[i].r;
+            greens[i] = block[i].g;
+        }
+
+        EncodeBC4Channel(reds, output.subspan<0, 8>());
+        EncodeBC4Channel(greens, output.subspan<8, 8>());
+    }
+
+    void BlockCompressor::EncodeBC7(const Block &block, const std::span<uint8_t, 16> output) {
+        constexpr std::array<uint32_t, 16> weights{0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+        Texels<4> texels{};
+        for (uint32_t i = 0; i < k_BlockTexelCount; i++)
+            texels[i] = glm::vec4{block[i]};
+
+        const auto [low, high] = FindEndpoints<4>(texels);
+
+        // Mode 6 endpoints are 7 bits per channel plus a p-bit shared by the channels of each endpoint.
+        std::array<glm::uvec4, 2> quantized{};
+        std::array<uint32_t, 2>   p_bits{};
+
+        const std::array<glm::vec4, 2> endpoints{low, high};
+        for (uint32_t e = 0; e < endpoints.size(); e++) {
+            glm::f32 best_error = std::numeric_limits<glm::f32>::max();
+
+            for (uint32_t p_bit = 0; p_bit < 2; p_bit++) {
+                const glm::uvec4 candidate = glm::uvec4{
+                    glm::clamp(glm::round((endpoints[e] - static_cast<glm::f32>(p_bit)) * 0.5f), 0.0f, 127.0f)};
+
+                const glm::vec4 delta = glm::vec4{candidate * 2u + p_bit} - endpoints[e];
+                const glm::f32  error = glm::dot(delta, delta);
+                if (error < best_error) {
+                    quantized[e] = candidate;
+                    p_bits[e]    = p_bit;
+                    best_error   = error;
+                }
+            }
+        }
+
+        const glm::uvec4 endpoint0 = quantized[0] * 2u + p_bits[0];
+        const glm::uvec4 endpoint1 = quantized[1] * 2u + p_bits[1];
+
+        std::array<glm::vec4, 16> palette{};
+        for (uint32_t j = 0; j < palette.size(); j++)
+            palette[j] = glm::vec4{((64u - weights[j]) * endpoint0 + weights[j] * endpoint1 + 32u) >> 6u};
+
+        std::array<uint32_t, k_BlockTexelCount> indices{};
+        for (uint32_t i = 0; i < k_BlockTexelCount; i++) {
+            glm::f32 best_distance = std::numeric_limits<glm::f32>::max();
+
+            for (uint32_t j = 0; j < palette.size(); j++) {
+                const glm::vec4 delta    = texels[i] - palette[j];
+                const glm::f32  distance = glm::dot(delta, delta);
+                if (distance < best_distance) {
+                    indices[i]    = j;
+                    best_distance = distance;
+                }
+            }
+        }
+
+        // The anchor texel drops the top index bit, swapping the endpoints keeps it clear.
+        if (0 != (indices[0] & 8u)) {
+            std::swap(quantized[0], quantized[1]);
+            std::swap(p_bits[0], p_bits[1]);
+
+            for (uint32_t &index : indices)
+                index = 15u - index;
+        }
+
+        BlockBitWriter writer{};
+        writer.write(1u << 6, 7);
+
+        for (glm::length_t c = 0; c < 4; c++) {
+            writer.write(quantized[0][c], 7);
+            writer.write(quantized[1][c], 7);
+        }
+
+        writer.write(p_bits[0], 1);
+        writer.write(p_bits[1], 1);
+
+        writer.write(indices[0], 3);
+        for (uint32_t i = 1; i < k_BlockTexelCount; i++)
+            writer.write(indices[i], 4);
+
+        std::ranges::copy(writer.getBytes(), std::begin(output));
+    }
+
+    template <glm::length_t L>
+    std::pair<glm::vec<L, glm::f32>, glm::vec<L, glm::f32>> FindEndpoints(const Texels<L> &texels) {
+        using Vector = glm::vec<L, glm::f32>;
+        using Matrix = glm::mat<L, L, glm::f32>;
+
+        Vector mean{0.0f};
+        Vector min{255.0f};
+        Vector max{0.0f};
+        for (const Vector &texel : texels) {
+            mean += texel;
+            min = glm::min(min, texel);
+            max = glm::max(max, texel);
+        }
+        mean /= static_cast<glm::f32>(texels.size());
+
+        Matrix covariance{0.0f};
+        for (const Vector &texel : texels) {
+            const Vector delta = texel - mean;
+            covariance += glm::outerProduct(delta, delta);
+        }
+
+        // Power iteration towards the principal axis, seeded with the bounding box diagonal.
+        Vector axis = max - min;
+        for (uint32_t i = 0; i < 8; i++) {
+            const Vector   next   = covariance * axis;
+            const glm::f32 length = glm::length(next);
+            if (length < 1e-6f)
+                break;
+
+            axis = next / length;
+        }
+
+        if (glm::length(axis) < 1e-6f)
+            return {mean, mean};
+
+        axis = glm::normalize(axis);
+
+        glm::f32 min_projection = std::numeric_limits<glm::f32>::max();
+        glm::f32 max_projection = std::numeric_limits<glm::f32>::lowest();
+        for (const Vector &texel : texels) {
+            const glm::f32 projection = glm::dot(texel - mean, axis);
+            min_projection            = glm::min(min_projection, projection);
+            max_projection            = glm::max(max_projection, projection);
+        }
+
+        return {
+            glm::clamp(mean + axis * min_projection, Vector{0.0f}, Vector{255.0f}),
+            glm::clamp(mean + axis * max_projection, Vector{0.0f}, Vector{255.0f}),
+        };
+    }
+
+    void EncodeBC4Channel(const std::array<uint8_t, BlockCompressor::k_BlockTexelCount> &values, const std::span<uint8_t, 8> output) {
+        const auto [min, max] = std::ranges::minmax(values);
+
+        // red0 > red1 selects the eight value mode, equal endpoints need no indices at all.
+        output[0] = max;
+        output[1] = min;
+
+        uint64_t indices = 0;
+
+        if (max != min) {
+            std::array<uint32_t, 8> palette{max, min};
+            for (uint32_t j = 2; j < palette.size(); j++)
+                palette[j] = ((8 - j) * max + (j - 1) * min + 3) / 7;
+
+            for (uint32_t i = 0; i < values.size(); i++) {
+                uint64_t best_index    = 0;
+                uint32_t best_distance = std::numeric_limits<uint32_t>::max();
+
+                for (uint32_t j = 0; j < palette.size(); j++) {
+                    const auto distance = static_cast<uint32_t>(glm::abs(static_cast<int32_t>(values[i]) - static_cast<int32_t>(palette[j])));
+                    if (distance < best_distance) {
+                        best_index    = j;
+                        best_distance = distance;
+                    }
+                }
+
+                indices |= best_index << (3 * i);
+            }
+        }
+
+        for (uint32_t i = 0; i < 6; i++)
+            output[2 + i] = static_cast<uint8_t>(indices >> (8 * i));
+    }
+
+    uint16_t PackRGB565(const glm::vec3 &color) {
+        const glm::uvec3 quantized{glm::round(color * glm::vec3{31.0f, 63.0f, 31.0f} / 255.0f)};
+        return static_cast<uint16_t>((quantized.r << 11) | (quantized.g << 5) | quantized.b);
+    }
+
+    glm::vec3 UnpackRGB565(const uint16_t color) {
+        const uint32_t r = (color >> 11) & 31u;
+        const uint32_t g = (color >> 5) & 63u;
+        const uint32_t b = color & 31u;
+
+        return glm::vec3{
+            static_cast<glm::f32>((r << 3) | (r >> 2)),
+            static_cast<glm::f32>((g << 2) | (g >> 4)),
+            static_cast<glm::f32>((b << 3) | (b >> 2)),
+        };
+    }
+}  // namespace Ignis
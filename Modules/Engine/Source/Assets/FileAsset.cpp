@@ -1,58 +1,62 @@
 #include <Ignis/Assets/FileAsset.hpp>
+#include <Ignis/Assets/VirtualFileSystem.hpp>
+
+#if defined(IGNIS_PLATFORM_WINDOWS)
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <Windows.h>
+#elif defined(IGNIS_PLATFORM_UNIX)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
 
 namespace Ignis {
     std::optional<FileAsset> FileAsset::LoadTextFromPath(const std::filesystem::path &path) {
-        std::string spath = path.string();
-
-        if (!std::filesystem::exists(path)) {
-            DIGNIS_LOG_ENGINE_WARN("Failed to find a file from path: '{}'", spath);
-            return std::nullopt;
-        }
-
-        std::ifstream ifile{path, std::ios::ate};
-        DIGNIS_ASSERT(ifile.is_open(), "Failed to open file from path: '{}'", spath);
-
-        const size_t file_size = ifile.tellg();
-        std::string  content{};
-        content.resize(file_size);
-
-        ifile.seekg(0);
-        ifile.read(content.data(), file_size);
-        ifile.close();
-
-        DIGNIS_LOG_ENGINE_INFO("Loaded an Ignis::FileAsset from path: '{}'", spath);
-
-        return LoadFromMemory(path, content);
+        // Mapped text keeps its line endings, readers accept both.
+        return LoadBinaryFromPath(path);
     }
 
     std::optional<FileAsset> FileAsset::LoadBinaryFromPath(const std::filesystem::path &path) {
         std::string spath = path.string();
 
+        if (std::optional<FileAsset> file_asset = VirtualFileSystem::ReadMounted(path); file_asset.has_value()) {
+            DIGNIS_LOG_ENGINE_INFO("Loaded an Ignis::FileAsset from a mounted pak: '{}'", spath);
+            return file_asset;
+        }
+
         if (!std::filesystem::exists(path)) {
             DIGNIS_LOG_ENGINE_WARN("Failed to find a file from path: '{}'", spath);
             return std::nullopt;
         }
 
-        std::ifstream ifile{path, std::ios::ate | std::ios::binary};
-        DIGNIS_ASSERT(ifile.is_open(), "Failed to open file from path: '{}'", spath);
+        std::optional<FileAsset> file_asset = MapFromPath(path);
+        if (file_asset.has_value())
+            DIGNIS_LOG_ENGINE_INFO("Loaded an Ignis::FileAsset from path: '{}'", spath);
 
-        const size_t file_size = ifile.tellg();
-        std::string  content{};
-        content.resize(file_size);
+        return file_asset;
+    }
 
-        ifile.seekg(0);
-        ifile.read(content.data(), file_size);
-        ifile.close();
+    FileAsset FileAsset::LoadFromMemory(const std::filesystem::path &path, const std::string_view content) {
+        return LoadFromMemory(path, std::string{content});
+    }
 
-        DIGNIS_LOG_ENGINE_INFO("Loaded an Ignis::FileAsset from path: '{}'", spath);
+    FileAsset FileAsset::LoadFromMemory(const std::filesystem::path &path, std::string &&content) {
+        const auto owner = std::make_shared<const std::string>(std::move(content));
 
-        return LoadFromMemory(path, content);
+        FileAsset file_asset{};
+        file_asset.m_Path = path;
+        file_asset.m_Data = std::shared_ptr<const std::byte>(owner, reinterpret_cast<const std::byte *>(owner->data()));
+        file_asset.m_Size = owner->size();
+        return file_asset;
     }
 
-    FileAsset FileAsset::LoadFromMemory(const std::filesystem::path &path, const std::string_view content) {
+    FileAsset FileAsset::LoadFromSharedMemory(const std::filesystem::path &path, std::shared_ptr<const std::byte> data, const size_t size) {
         FileAsset file_asset{};
-        file_asset.m_Path    = path;
-        file_asset.m_Content = content;
+        file_asset.m_Path = path;
+        file_asset.m_Data = std::move(data);
+        file_asset.m_Size = size;
         return file_asset;
     }
 
@@ -60,11 +64,116 @@ namespace Ignis {
         return m_Path;
     }
 
+    std::span<const std::byte> FileAsset::getBytes() const {
+        return std::span{m_Data.get(), m_Size};
+    }
+
     std::string_view FileAsset::getContent() const {
-        return m_Content;
+        return std::string_view{reinterpret_cast<const char *>(m_Data.get()), m_Size};
+    }
+
+    const std::shared_ptr<const std::byte> &FileAsset::getSharedData() const {
+        return m_Data;
     }
 
     size_t FileAsset::getSize() const {
-        return m_Content.size();
+        return m_Size;
+    }
+
+    std::optional<FileAsset> FileAsset::MapFromPath(const std::filesystem::path &path) {
+        const std::string spath = path.string();
+
+        FileAsset file_asset{};
+        file_asset.m_Path = path;
+
+#if defined(IGNIS_PLATFORM_WINDOWS)
+        // Windows has no madvise, the sequential scan flag asks the cache manager for read-ahead instead.
+        const HANDLE file = CreateFileW(
+            path.c_str(),
+            GENERIC_READ,
+            FILE_SHARE_READ,
+            nullptr,
+            OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+            nullptr);
+        if (INVALID_HANDLE_VALUE == file) {
+            DIGNIS_LOG_ENGINE_WARN("Failed to open a file for mapping: '{}'", spath);
+            return std::nullopt;
+        }
+
+        LARGE_INTEGER file_size{};
+        if (!GetFileSizeEx(file, &file_size)) {
+            CloseHandle(file);
+            DIGNIS_LOG_ENGINE_WARN("Failed to query the size of a file: '{}'", spath);
+            return std::nullopt;
+        }
+
+        const size_t size = static_cast<size_t>(file_size.QuadPart);
+
+        // Empty files cannot be mapped and have no bytes to view.
+        if (0 == size) {
+            CloseHandle(file);
+            return file_asset;
+        }
+
+        // The view keeps the file and the mapping object alive on its own.
+        const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (nullptr == mapping) {
+            DIGNIS_LOG_ENGINE_WARN("Failed to map a file: '{}'", spath);
+            return std::nullopt;
+        }
+
+        void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+        if (nullptr == view) {
+            DIGNIS_LOG_ENGINE_WARN("Failed to map a view of a file: '{}'", spath);
+            return std::nullopt;
+        }
+
+        file_asset.m_Data = std::shared_ptr<const std::byte>(static_cast<const std::byte *>(view), [view](const std::byte *) {
+            UnmapViewOfFile(view);
+        });
+#elif defined(IGNIS_PLATFORM_UNIX)
+        const int32_t file = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (file < 0) {
+            DIGNIS_LOG_ENGINE_WARN("Failed to open a file for mapping: '{}'", spath);
+            return std::nullopt;
+        }
+
+        struct stat file_stat {};
+        if (0 != fstat(file, &file_stat)) {
+            close(file);
+            DIGNIS_LOG_ENGINE_WARN("Failed to query the size of a file: '{}'", spath);
+            return std::nullopt;
+        }
+
+        const size_t size = static_cast<size_t>(file_stat.st_size);
+
+        // Empty files cannot be mapped and have no bytes to view.
+        if (0 == size) {
+            close(file);
+            return file_asset;
+        }
+
+        // The mapping keeps the file alive on its own.
+        void *view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+        close(file);
+        if (MAP_FAILED == view) {
+            DIGNIS_LOG_ENGINE_WARN("Failed to map a file: '{}'", spath);
+            return std::nullopt;
+        }
+
+        // Loaders walk files front to back, so read-ahead pays and pages behind the reader can go.
+        madvise(view, size, MADV_SEQUENTIAL);
+
+        file_asset.m_Data = std::shared_ptr<const std::byte>(static_cast<const std::byte *>(view), [view, size](const std::byte *) {
+            munmap(view, size);
+        });
+#endif
+
+        file_asset.m_Size = size;
+
+        return file_asset;
     }
-}  // namespace Ignis
\ No newline at end of file
+}  // namespace Ignis
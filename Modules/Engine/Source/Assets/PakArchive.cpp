@@ -0,0 +1,275 @@
+#include <Ignis/Assets/PakArchive.hpp>
+
+#include <lz4.h>
+#include <lz4hc.h>
+
+namespace Ignis {
+    constexpr int32_t k_PakLZ4Level = LZ4HC_CLEVEL_DEFAULT;
+
+    // Entries LZ4 cannot shrink by an eighth are stored, already-compressed files decode faster that way.
+    constexpr uint64_t k_PakMinimumSavingRatio = 8;
+
+    void PadPakFile(std::ofstream &ofile, uint64_t alignment);
+
+    std::optional<std::unique_ptr<PakArchive>> PakArchive::Open(const std::filesystem::path &path) {
+        const std::string spath = path.string();
+
+        std::optional<FileAsset> file = FileAsset::LoadBinaryFromPath(path);
+        if (!file.has_value()) {
+            DIGNIS_LOG_ENGINE_WARN("Failed to open a pak archive from path: '{}'", spath);
+            return std::nullopt;
+        }
+
+        const std::span<const std::byte> bytes     = file->getBytes();
+        const uint64_t                   file_size = bytes.size();
+
+        Header header{};
+        if (file_size < sizeof(Header)) {
+            DIGNIS_LOG_ENGINE_WARN("The pak archive is truncated: '{}'", spath);
+            return std::nullopt;
+        }
+
+        memcpy(&header, bytes.data(), sizeof(Header));
+
+        if (k_Magic != header.Magic || k_Version != header.Version) {
+            DIGNIS_LOG_ENGINE_WARN("Failed to read a pak archive of this version from path: '{}'", spath);
+            return std::nullopt;
+        }
+
+        // Offsets are compared against what is left of the file, so crafted values cannot wrap past it.
+        const uint64_t index_size = static_cast<uint64_t>(header.EntryCount) * sizeof(Entry);
+        if (header.IndexOffset > file_size || index_size > file_size - header.IndexOffset ||
+            header.NamesOffset > file_size || header.NamesSize > file_size - header.NamesOffset) {
+            DIGNIS_LOG_ENGINE_WARN("The pak archive is truncated: '{}'", spath);
+            return std::nullopt;
+        }
+
+        auto pak_archive = std::make_unique<PakArchive>();
+        pak_archive->m_Path = path;
+
+        // The index is copied out so entries stay aligned, names and data are read in place.
+        pak_archive->m_Entries.resize(header.EntryCount);
+        memcpy(pak_archive->m_Entries.data(), bytes.data() + header.IndexOffset, header.EntryCount * sizeof(Entry));
+
+        pak_archive->m_Names = file->getContent().substr(header.NamesOffset, header.NamesSize);
+
+        for (const Entry &entry : pak_archive->m_Entries) {
+            if (entry.Offset > file_size || entry.StoredSize > file_size - entry.Offset ||
+                static_cast<uint64_t>(entry.NameOffset) + entry.NameSize > header.NamesSize) {
+                DIGNIS_LOG_ENGINE_WARN("The pak archive has an entry out of bounds: '{}'", spath);
+                return std::nullopt;
+            }
+
+            // Stored entries are viewed in place at their full size, LZ4 takes its sizes as 32-bit integers.
+            const bool is_valid_entry =
+                Compression::eNone == entry.Codec
+                    ? entry.Size == entry.StoredSize
+                    : Compression::eLZ4 == entry.Codec &&
+                          entry.Size <= static_cast<uint64_t>(std::numeric_limits<int32_t>::max()) &&
+                          entry.StoredSize <= static_cast<uint64_t>(std::numeric_limits<int32_t>::max());
+            if (!is_valid_entry) {
+                DIGNIS_LOG_ENGINE_WARN("The pak archive has an invalid entry: '{}'", spath);
+                return std::nullopt;
+            }
+        }
+
+        pak_archive->m_File = std::move(file.value());
+
+        DIGNIS_LOG_ENGINE_INFO("Opened an Ignis::PakArchive with {} entries from path: '{}'", header.EntryCount, spath);
+
+        return pak_archive;
+    }
+
+    bool PakArchive::Write(const std::filesystem::path &pak_path, const std::filesystem::path &directory) {
+        const std::string spath = pak_path.string();
+
+        const std::filesystem::path canonical_pak_path = std::filesystem::weakly_canonical(pak_path);
+
+        std::vector<std::string> names{};
+
+        std::error_code error{};
+        for (const std::filesystem::directory_entry &directory_entry :
+             std::filesystem::recursive_directory_iterator{
+                 directory,
+                 std::filesystem::directory_options::skip_permission_denied,
+                 error}) {
+            if (!directory_entry.is_regular_file() ||
+                canonical_pak_path == std::filesystem::weakly_canonical(directory_entry.path()))
+                continue;
+
+            names.push_back(std::filesystem::proximate(directory_entry.path(), directory).generic_string());
+        }
+
+        if (error) {
+            DIGNIS_LOG_ENGINE_WARN("Failed to scan a directory for packing: '{}'. Error: '{}'", directory.string(), error.message());
+            return false;
+        }
+
+        // Sorted names keep the data layout stable between packs.
+        std::ranges::sort(names);
+
+        std::ofstream ofile{pak_path, std::ios::binary | std::ios::trunc};
+        if (!ofile.is_open()) {
+            DIGNIS_LOG_ENGINE_WARN("Failed to open a pak archive for writing: '{}'", spath);
+            return false;
+        }
+
+        Header header{};
+        header.Magic      = k_Magic;
+        header.Version    = k_Version;
+        header.EntryCount = static_cast<uint32_t>(names.size());
+
+        ofile.write(reinterpret_cast<const char *>(&header), sizeof(Header));
+
+        std::vector<Entry> entries{};
+        entries.reserve(names.size());
+
+        std::string names_blob{};
+
+        uint64_t total_size  = 0;
+        uint64_t stored_size = 0;
+
+        std::string compressed{};
+        for (const std::string &name : names) {
+            const std::optional<FileAsset> file = FileAsset::LoadBinaryFromPath(directory / name);
+            if (!file.has_value()) {
+                DIGNIS_LOG_ENGINE_WARN("Failed to read a file for packing: '{}'", name);
+                return false;
+            }
+
+            const std::string_view content = file->getContent();
+
+            Entry entry{};
+            entry.PathHash   = HashPath(name);
+            entry.Size       = content.size();
+            entry.NameOffset = static_cast<uint32_t>(names_blob.size());
+            entry.NameSize   = static_cast<uint32_t>(name.size());
+            entry.Codec      = Compression::eNone;
+
+            names_blob += name;
+
+            std::string_view stored = content;
+
+            if (!content.empty() && content.size() <= LZ4_MAX_INPUT_SIZE) {
+                compressed.resize(LZ4_compressBound(static_cast<int32_t>(content.size())));
+
+                const int32_t compressed_size = LZ4_compress_HC(
+                    content.data(),
+                    compressed.data(),
+                    static_cast<int32_t>(content.size()),
+                    static_cast<int32_t>(compressed.size()),
+                    k_PakLZ4Level);
+
+                if (0 < compressed_size &&
+                    static_cast<uint64_t>(compressed_size) < content.size() - content.size() / k_PakMinimumSavingRatio) {
+                    entry.Codec = Compression::eLZ4;
+                    stored      = std::string_view{compressed.data(), static_cast<size_t>(compressed_size)};
+                }
+            }
+
+            PadPakFile(ofile, Compression::eNone == entry.Codec ? k_PageAlignment : k_EntryAlignment);
+
+            entry.Offset     = ofile.tellp();
+            entry.StoredSize = stored.size();
+
+            ofile.write(stored.data(), static_cast<std::streamsize>(stored.size()));
+
+            total_size += entry.Size;
+            stored_size += entry.StoredSize;
+
+            entries.push_back(entry);
+        }
+
+        std::ranges::sort(entries, [&names_blob](const Entry &lhs, const Entry &rhs) {
+            if (lhs.PathHash != rhs.PathHash)
+                return lhs.PathHash < rhs.PathHash;
+            return names_blob.compare(lhs.NameOffset, lhs.NameSize, names_blob, rhs.NameOffset, rhs.NameSize) < 0;
+        });
+
+        PadPakFile(ofile, k_EntryAlignment);
+
+        header.IndexOffset = ofile.tellp();
+        ofile.write(reinterpret_cast<const char *>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(Entry)));
+
+        header.NamesOffset = ofile.tellp();
+        header.NamesSize   = names_blob.size();
+        ofile.write(names_blob.data(), static_cast<std::streamsize>(names_blob.size()));
+
+        ofile.seekp(0);
+        ofile.write(reinterpret_cast<const char *>(&header), sizeof(Header));
+
+        if (!ofile) {
+            DIGNIS_LOG_ENGINE_WARN("Failed to write a pak archive: '{}'", spath);
+            return false;
+        }
+
+        ofile.close();
+
+        DIGNIS_LOG_ENGINE_INFO("Packed {} files, {} bytes into {} bytes, to path: '{}'", entries.size(), total_size, stored_size, spath);
+
+        return true;
+    }
+
+    uint64_t PakArchive::HashPath(const std::string_view name) {
+        return XXH3_64bits(name.data(), name.size());
+    }
+
+    const PakArchive::Entry *PakArchive::find(const std::string_view name) const {
+        const uint64_t hash = HashPath(name);
+
+        for (auto it = std::ranges::lower_bound(m_Entries, hash, {}, &Entry::PathHash);
+             std::end(m_Entries) != it && hash == it->PathHash;
+             ++it) {
+            if (name == getName(*it))
+                return &*it;
+        }
+
+        return nullptr;
+    }
+
+    std::optional<FileAsset> PakArchive::read(const Entry &entry) const {
+        const std::filesystem::path path = m_Path / getName(entry);
+
+        const std::byte *stored = m_File.getBytes().data() + entry.Offset;
+
+        // Stored entries are views into the mapped archive and keep it alive, nothing is copied.
+        if (Compression::eNone == entry.Codec)
+            return FileAsset::LoadFromSharedMemory(path, std::shared_ptr<const std::byte>(m_File.getSharedData(), stored), entry.Size);
+
+        std::string content{};
+        content.resize(entry.Size);
+
+        const int32_t decompressed_size = LZ4_decompress_safe(
+            reinterpret_cast<const char *>(stored),
+            content.data(),
+            static_cast<int32_t>(entry.StoredSize),
+            static_cast<int32_t>(content.size()));
+
+        if (decompressed_size < 0 || entry.Size != static_cast<uint64_t>(decompressed_size)) {
+            DIGNIS_LOG_ENGINE_WARN("Failed to decompress '{}' from the pak archive: '{}'", getName(entry), m_Path.string());
+            return std::nullopt;
+        }
+
+        return FileAsset::LoadFromMemory(path, std::move(content));
+    }
+
+    std::string_view PakArchive::getName(const Entry &entry) const {
+        return m_Names.substr(entry.NameOffset, entry.NameSize);
+    }
+
+    const std::filesystem::path &PakArchive::getPath() const {
+        return m_Path;
+    }
+
+    const std::vector<PakArchive::Entry> &PakArchive::getEntries() const {
+        return m_Entries;
+    }
+
+    void PadPakFile(std::ofstream &ofile, const uint64_t alignment) {
+        const uint64_t offset  = ofile.tellp();
+        const uint64_t padding = (alignment - offset % alignment) % alignment;
+
+        constexpr std::array<char, PakArchive::k_PageAlignment> zeros{};
+        ofile.write(zeros.data(), static_cast<std::streamsize>(padding));
+    }
+}  // namespace Ignis
@@ -1,21 +1,146 @@
 #include <Ignis/Assets/TextureAsset.hpp>
+#include <Ignis/Assets/BlockCompressor.hpp>
+#include <Ignis/Assets/FileAsset.hpp>
 
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
 
+#include <zlib.h>
+#include <zstd.h>
+
 namespace Ignis {
+    struct KTX2Header {
+        std::array<uint8_t, 12> Identifier;
+
+        uint32_t VkFormat;
+        uint32_t TypeSize;
+        uint32_t PixelWidth;
+        uint32_t PixelHeight;
+        uint32_t PixelDepth;
+        uint32_t LayerCount;
+        uint32_t FaceCount;
+        uint32_t LevelCount;
+        uint32_t SupercompressionScheme;
+
+        uint32_t DfdByteOffset;
+        uint32_t DfdByteLength;
+        uint32_t KvdByteOffset;
+        uint32_t KvdByteLength;
+        uint64_t SgdByteOffset;
+        uint64_t SgdByteLength;
+    };
+    static_assert(80 == sizeof(KTX2Header));
+
+    struct KTX2LevelIndex {
+        uint64_t ByteOffset;
+        uint64_t ByteLength;
+        uint64_t UncompressedByteLength;
+    };
+
+    enum class KTX2Supercompression : uint32_t {
+        eNone,
+        eBasisLZ,
+        eZstandard,
+        eZLIB,
+    };
+
+    struct DDSPixelFormat {
+        uint32_t Size;
+        uint32_t Flags;
+        uint32_t FourCC;
+        uint32_t RGBBitCount;
+        uint32_t RBitMask;
+        uint32_t GBitMask;
+        uint32_t BBitMask;
+        uint32_t ABitMask;
+    };
+
+    struct DDSHeader {
+        uint32_t Size;
+        uint32_t Flags;
+        uint32_t Height;
+        uint32_t Width;
+        uint32_t PitchOrLinearSize;
+        uint32_t Depth;
+        uint32_t MipMapCount;
+
+        std::array<uint32_t, 11> Reserved1;
+
+        DDSPixelFormat PixelFormat;
+
+        uint32_t Caps;
+        uint32_t Caps2;
+        uint32_t Caps3;
+        uint32_t Caps4;
+        uint32_t Reserved2;
+    };
+    static_assert(124 == sizeof(DDSHeader));
+
+    struct DDSHeaderDX10 {
+        uint32_t DXGIFormat;
+        uint32_t ResourceDimension;
+        uint32_t MiscFlag;
+        uint32_t ArraySize;
+        uint32_t MiscFlags2;
+    };
+
+    constexpr std::array<uint8_t, 12> k_KTX2Identifier{0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+
+    // Cooked textures are written once and read on every load, so the level favours ratio over speed.
+    constexpr int32_t k_KTX2ZstdLevel = 9;
+
+    // The limits every Vulkan device supports, larger headers are rejected before any size is computed from them.
+    constexpr uint32_t k_MaxTextureExtent     = 16384;
+    constexpr uint64_t k_MaxTextureLayerCount = 2048;
+
+    constexpr uint32_t k_DDSFlagMipMapCount     = 0x20000;
+    constexpr uint32_t k_DDSPixelFormatFourCC   = 0x4;
+    constexpr uint32_t k_DDSPixelFormatRGB      = 0x40;
+    constexpr uint32_t k_DDSCaps2Cubemap        = 0x200;
+    constexpr uint32_t k_DDSCaps2Volume         = 0x200000;
+    constexpr uint32_t k_DDSDimensionTexture2D  = 3;
+    constexpr uint32_t k_DDSMiscFlagTextureCube = 0x4;
+
+    constexpr uint32_t MakeFourCC(const char a, const char b, const char c, const char d) {
+        return static_cast<uint32_t>(static_cast<uint8_t>(a)) |
+               static_cast<uint32_t>(static_cast<uint8_t>(b)) << 8 |
+               static_cast<uint32_t>(static_cast<uint8_t>(c)) << 16 |
+               static_cast<uint32_t>(static_cast<uint8_t>(d)) << 24;
+    }
+
+    constexpr uint32_t k_DDSMagic      = MakeFourCC('D', 'D', 'S', ' ');
+    constexpr uint32_t k_DDSFourCCDX10 = MakeFourCC('D', 'X', '1', '0');
+
+    template <typename T>
+    bool ReadStruct(std::span<const uint8_t> bytes, uint64_t offset, T &value);
+
+    std::optional<std::pair<TextureAsset::Type, bool>> TranslateVkFormat(vk::Format format);
+    std::optional<std::pair<TextureAsset::Type, bool>> TranslateDXGIFormat(uint32_t dxgi_format);
+    std::optional<std::pair<TextureAsset::Type, bool>> TranslateDDSPixelFormat(const DDSPixelFormat &pixel_format);
+
     std::optional<TextureAsset> TextureAsset::LoadFromPath(
         const std::filesystem::path &path,
-        const Type                   type) {
+        const Type                   type,
+        const Allocator             &allocator) {
         const std::string spath = path.string();
 
-        if (!std::filesystem::exists(path)) {
+        // Decoding from memory serves files from mounted paks the same as files on disk.
+        const std::optional<FileAsset> file = FileAsset::LoadBinaryFromPath(path);
+        if (!file.has_value()) {
             DIGNIS_LOG_ENGINE_WARN("Failed to find a texture from path: '{}'", spath);
             return std::nullopt;
         }
 
-        const char *texture_path = spath.c_str();
+        const std::span<const std::byte> bytes = file->getBytes();
 
+        std::optional<TextureAsset> texture_asset = LoadFromMemory(bytes.data(), bytes.size(), type, allocator);
+        if (texture_asset.has_value())
+            DIGNIS_LOG_ENGINE_INFO("Loaded an Ignis::TextureAsset from path: '{}'", spath);
+
+        return texture_asset;
+    }
+
+    std::optional<TextureAsset> TextureAsset::LoadFromMemory(const void *data, const size_t size, const Type type, const Allocator &allocator) {
         int32_t width  = 0;
         int32_t height = 0;
 
@@ -28,18 +153,35 @@ namespace Ignis {
             case Type::eRGBA32f:
             case Type::eRGB32f: {
                 texture_data =
-                    reinterpret_cast<uint8_t *>(stbi_loadf(texture_path, &width, &height, nullptr, desired_channels));
+                    reinterpret_cast<uint8_t *>(stbi_loadf_from_memory(
+                        static_cast<stbi_uc const *>(data), size, &width, &height, nullptr, desired_channels));
             } break;
             case Type::eRGBA16u:
             case Type::eRGB16u: {
                 texture_data =
-                    reinterpret_cast<uint8_t *>(stbi_load_16(texture_path, &width, &height, nullptr, desired_channels));
+                    reinterpret_cast<uint8_t *>(stbi_load_16_from_memory(
+                        static_cast<stbi_uc const *>(data), size, &width, &height, nullptr, desired_channels));
             } break;
             case Type::eRGBA8u:
             case Type::eRGB8u: {
-                texture_data = stbi_load(texture_path, &width, &height, nullptr, desired_channels);
-
+                texture_data = stbi_load_from_memory(
+                    static_cast<stbi_uc const *>(data), size, &width, &height, nullptr, desired_channels);
             } break;
+            case Type::eBC1:
+            case Type::eBC2:
+            case Type::eBC3:
+            case Type::eBC4:
+            case Type::eBC5:
+            case Type::eBC6H:
+            case Type::eBC7: {
+                DIGNIS_LOG_ENGINE_WARN("Block-compressed textures come from TextureAsset::compress, cannot decode from memory");
+                return std::nullopt;
+            }
+        }
+
+        if (nullptr == texture_data) {
+            DIGNIS_LOG_ENGINE_WARN("Failed to decode a texture: '{}'", stbi_failure_reason());
+            return std::nullopt;
         }
 
         const size_t texture_size = width * height * texel_size;
@@ -49,60 +191,292 @@ namespace Ignis {
         texture_asset.m_Height = height;
         texture_asset.m_Type   = type;
 
-        texture_asset.m_Data.clear();
-        texture_asset.m_Data.resize(texture_size);
-
-        memcpy(texture_asset.m_Data.data(), texture_data, texture_size);
+        // stb only decodes into its own buffer, so this copy goes straight to the destination.
+        const bool is_allocated = texture_asset.allocateData(texture_size, allocator);
+        if (is_allocated)
+            memcpy(texture_asset.getMutableData().data(), texture_data, texture_size);
 
         stbi_image_free(texture_data);
 
-        DIGNIS_LOG_ENGINE_INFO("Loaded an Ignis::TextureAsset from path: '{}'", spath);
+        if (!is_allocated)
+            return std::nullopt;
 
         return texture_asset;
     }
 
-    std::optional<TextureAsset> TextureAsset::LoadFromMemory(const void *data, const size_t size, const Type type) {
-        int32_t width  = 0;
-        int32_t height = 0;
+    std::optional<TextureAsset> TextureAsset::LoadKTX2FromPath(const std::filesystem::path &path, const Allocator &allocator, const MipRange &mip_range) {
+        const std::optional<FileAsset> file_asset = FileAsset::LoadBinaryFromPath(path);
+        if (!file_asset.has_value())
+            return std::nullopt;
 
-        const int32_t desired_channels = GetChannelCount(type);
-        const int32_t texel_size       = GetChannelSize(type);
+        const std::span<const std::byte> bytes = file_asset->getBytes();
 
-        uint8_t *texture_data = nullptr;
+        std::optional<TextureAsset> texture_asset = LoadKTX2FromMemory(bytes.data(), bytes.size(), allocator, mip_range);
+        if (texture_asset.has_value())
+            DIGNIS_LOG_ENGINE_INFO("Loaded an Ignis::TextureAsset from path: '{}'", path.string());
+        else
+            DIGNIS_LOG_ENGINE_WARN("Failed to load a KTX2 texture from path: '{}'", path.string());
 
-        switch (type) {
-            case Type::eRGBA32f:
-            case Type::eRGB32f: {
-                texture_data =
-                    reinterpret_cast<uint8_t *>(stbi_loadf_from_memory(
-                        static_cast<stbi_uc const *>(data), size, &width, &height, nullptr, desired_channels));
-            } break;
-            case Type::eRGBA16u:
-            case Type::eRGB16u: {
-                texture_data =
-                    reinterpret_cast<uint8_t *>(stbi_load_16_from_memory(
-                        static_cast<stbi_uc const *>(data), size, &width, &height, nullptr, desired_channels));
-            } break;
-            case Type::eRGBA8u:
-            case Type::eRGB8u: {
-                texture_data = stbi_load_from_memory(
-                    static_cast<stbi_uc const *>(data), size, &width, &height, nullptr, desired_channels);
-            } break;
+        return texture_asset;
+    }
+
+    std::optional<TextureAsset> TextureAsset::LoadKTX2FromMemory(
+        const void      *data,
+        const size_t     size,
+        const Allocator &allocator,
+        const MipRange  &mip_range) {
+        const std::span bytes{static_cast<const uint8_t *>(data), size};
+
+        KTX2Header header{};
+        if (!ReadStruct(bytes, 0, header) || k_KTX2Identifier != header.Identifier) {
+            DIGNIS_LOG_ENGINE_WARN("The data is not a KTX2 texture");
+            return std::nullopt;
         }
 
-        const size_t texture_size = width * height * texel_size;
+        if (0 == header.PixelWidth || 0 == header.PixelHeight || 0 != header.PixelDepth) {
+            DIGNIS_LOG_ENGINE_WARN("Only 2D KTX2 textures are supported");
+            return std::nullopt;
+        }
+
+        if (header.PixelWidth > k_MaxTextureExtent || header.PixelHeight > k_MaxTextureExtent) {
+            DIGNIS_LOG_ENGINE_WARN("The KTX2 texture is larger than {} texels", k_MaxTextureExtent);
+            return std::nullopt;
+        }
+
+        const auto scheme = static_cast<KTX2Supercompression>(header.SupercompressionScheme);
+        if (KTX2Supercompression::eNone != scheme &&
+            KTX2Supercompression::eZstandard != scheme &&
+            KTX2Supercompression::eZLIB != scheme) {
+            DIGNIS_LOG_ENGINE_WARN("Unsupported KTX2 supercompression scheme: {}", header.SupercompressionScheme);
+            return std::nullopt;
+        }
+
+        const std::optional<std::pair<Type, bool>> format = TranslateVkFormat(static_cast<vk::Format>(header.VkFormat));
+        if (!format.has_value()) {
+            DIGNIS_LOG_ENGINE_WARN("Unsupported KTX2 format: {}", header.VkFormat);
+            return std::nullopt;
+        }
+
+        if (1 != header.FaceCount && 6 != header.FaceCount) {
+            DIGNIS_LOG_ENGINE_WARN("The KTX2 texture has an invalid face count: {}", header.FaceCount);
+            return std::nullopt;
+        }
+
+        const uint64_t layer_count = static_cast<uint64_t>(glm::max(header.LayerCount, 1u)) * header.FaceCount;
+        if (layer_count > k_MaxTextureLayerCount) {
+            DIGNIS_LOG_ENGINE_WARN("The KTX2 texture has too many layers");
+            return std::nullopt;
+        }
 
         TextureAsset texture_asset{};
-        texture_asset.m_Width  = width;
-        texture_asset.m_Height = height;
-        texture_asset.m_Type   = type;
+        texture_asset.m_Width  = header.PixelWidth;
+        texture_asset.m_Height = header.PixelHeight;
+        texture_asset.m_Type   = format->first;
+        texture_asset.m_IsSRGB = format->second;
 
-        texture_asset.m_Data.clear();
-        texture_asset.m_Data.resize(texture_size);
+        // A level count of zero asks the loader to generate mips, only the base level is stored then.
+        texture_asset.m_MipLevelCount = glm::max(header.LevelCount, 1u);
+        texture_asset.m_LayerCount    = static_cast<uint32_t>(layer_count);
 
-        memcpy(texture_asset.m_Data.data(), texture_data, texture_size);
+        if (texture_asset.m_MipLevelCount > std::bit_width(glm::max(header.PixelWidth, header.PixelHeight))) {
+            DIGNIS_LOG_ENGINE_WARN("The KTX2 texture has more mip levels than its extent allows");
+            return std::nullopt;
+        }
 
-        stbi_image_free(texture_data);
+        texture_asset.selectMipLevels(mip_range);
+
+        const uint32_t first_mip_level = texture_asset.m_FirstMipLevel;
+        const uint32_t end_mip_level   = first_mip_level + texture_asset.m_ResidentMipLevelCount;
+
+        // Every kept level is checked against the file before anything is allocated, so a small malformed header
+        // cannot ask for more memory than its levels decode to.
+        std::vector<KTX2LevelIndex> level_indices(texture_asset.m_ResidentMipLevelCount);
+        for (uint32_t mip_level = first_mip_level; mip_level < end_mip_level; mip_level++) {
+            KTX2LevelIndex &level_index = level_indices[mip_level - first_mip_level];
+            if (!ReadStruct(bytes, sizeof(KTX2Header) + sizeof(KTX2LevelIndex) * mip_level, level_index) ||
+                level_index.ByteOffset > size || level_index.ByteLength > size - level_index.ByteOffset) {
+                DIGNIS_LOG_ENGINE_WARN("The KTX2 texture is truncated");
+                return std::nullopt;
+            }
+
+            const uint64_t level_size =
+                KTX2Supercompression::eNone == scheme ? level_index.ByteLength : level_index.UncompressedByteLength;
+            if (level_size != texture_asset.getMipOffset(mip_level + 1) - texture_asset.getMipOffset(mip_level)) {
+                DIGNIS_LOG_ENGINE_WARN("The KTX2 level {} has an unexpected size", mip_level);
+                return std::nullopt;
+            }
+        }
+
+        // Supercompressed levels are decoded straight into the destination.
+        if (!texture_asset.allocateData(texture_asset.getMipOffset(end_mip_level), allocator))
+            return std::nullopt;
+
+        // Levels are laid out like our own data, every layer and face of a level one after another.
+        // Each level is indexed on its own, so the levels that are not kept are never touched.
+        for (uint32_t mip_level = first_mip_level; mip_level < end_mip_level; mip_level++) {
+            const KTX2LevelIndex &level_index = level_indices[mip_level - first_mip_level];
+
+            const uint8_t *src      = bytes.data() + level_index.ByteOffset;
+            uint8_t       *dst      = texture_asset.getMutableData().data() + texture_asset.getMipOffset(mip_level);
+            const uint64_t dst_size = texture_asset.getMipData(mip_level).size();
+
+            switch (scheme) {
+                case KTX2Supercompression::eNone: {
+                    memcpy(dst, src, dst_size);
+                } break;
+                case KTX2Supercompression::eZstandard: {
+                    const size_t decoded_size = ZSTD_decompress(dst, dst_size, src, level_index.ByteLength);
+                    if (ZSTD_isError(decoded_size) || decoded_size != dst_size) {
+                        DIGNIS_LOG_ENGINE_WARN("Failed to decode the Zstandard KTX2 level {}", mip_level);
+                        return std::nullopt;
+                    }
+                } break;
+                case KTX2Supercompression::eZLIB: {
+                    auto decoded_size = static_cast<uLongf>(dst_size);
+                    if (Z_OK != uncompress(dst, &decoded_size, src, static_cast<uLong>(level_index.ByteLength)) ||
+                        decoded_size != dst_size) {
+                        DIGNIS_LOG_ENGINE_WARN("Failed to decode the ZLIB KTX2 level {}", mip_level);
+                        return std::nullopt;
+                    }
+                } break;
+                default:
+                    break;
+            }
+        }
+
+        return texture_asset;
+    }
+
+    std::optional<TextureAsset> TextureAsset::LoadDDSFromPath(const std::filesystem::path &path, const Allocator &allocator, const MipRange &mip_range) {
+        const std::optional<FileAsset> file_asset = FileAsset::LoadBinaryFromPath(path);
+        if (!file_asset.has_value())
+            return std::nullopt;
+
+        const std::span<const std::byte> bytes = file_asset->getBytes();
+
+        std::optional<TextureAsset> texture_asset = LoadDDSFromMemory(bytes.data(), bytes.size(), allocator, mip_range);
+        if (texture_asset.has_value())
+            DIGNIS_LOG_ENGINE_INFO("Loaded an Ignis::TextureAsset from path: '{}'", path.string());
+        else
+            DIGNIS_LOG_ENGINE_WARN("Failed to load a DDS texture from path: '{}'", path.string());
+
+        return texture_asset;
+    }
+
+    std::optional<TextureAsset> TextureAsset::LoadDDSFromMemory(
+        const void      *data,
+        const size_t     size,
+        const Allocator &allocator,
+        const MipRange  &mip_range) {
+        const std::span bytes{static_cast<const uint8_t *>(data), size};
+
+        uint32_t  magic = 0;
+        DDSHeader header{};
+        if (!ReadStruct(bytes, 0, magic) || k_DDSMagic != magic ||
+            !ReadStruct(bytes, sizeof(magic), header) || sizeof(DDSHeader) != header.Size) {
+            DIGNIS_LOG_ENGINE_WARN("The data is not a DDS texture");
+            return std::nullopt;
+        }
+
+        uint64_t data_offset = sizeof(magic) + sizeof(DDSHeader);
+        uint64_t layer_count = 1;
+
+        std::optional<std::pair<Type, bool>> format = std::nullopt;
+
+        if (0 != (header.PixelFormat.Flags & k_DDSPixelFormatFourCC) && k_DDSFourCCDX10 == header.PixelFormat.FourCC) {
+            DDSHeaderDX10 header_dx10{};
+            if (!ReadStruct(bytes, data_offset, header_dx10)) {
+                DIGNIS_LOG_ENGINE_WARN("The DDS texture is truncated");
+                return std::nullopt;
+            }
+            data_offset += sizeof(DDSHeaderDX10);
+
+            if (k_DDSDimensionTexture2D != header_dx10.ResourceDimension) {
+                DIGNIS_LOG_ENGINE_WARN("Only 2D DDS textures are supported");
+                return std::nullopt;
+            }
+
+            format      = TranslateDXGIFormat(header_dx10.DXGIFormat);
+            layer_count = glm::max(header_dx10.ArraySize, 1u);
+            if (0 != (header_dx10.MiscFlag & k_DDSMiscFlagTextureCube))
+                layer_count *= 6;
+        } else {
+            if (0 != (header.Caps2 & k_DDSCaps2Volume)) {
+                DIGNIS_LOG_ENGINE_WARN("Only 2D DDS textures are supported");
+                return std::nullopt;
+            }
+
+            format = TranslateDDSPixelFormat(header.PixelFormat);
+            if (0 != (header.Caps2 & k_DDSCaps2Cubemap))
+                layer_count = 6;
+        }
+
+        if (!format.has_value()) {
+            DIGNIS_LOG_ENGINE_WARN("Unsupported DDS pixel format");
+            return std::nullopt;
+        }
+
+        if (0 == header.Width || 0 == header.Height) {
+            DIGNIS_LOG_ENGINE_WARN("The DDS texture has no extent");
+            return std::nullopt;
+        }
+
+        if (header.Width > k_MaxTextureExtent || header.Height > k_MaxTextureExtent) {
+            DIGNIS_LOG_ENGINE_WARN("The DDS texture is larger than {} texels", k_MaxTextureExtent);
+            return std::nullopt;
+        }
+
+        if (layer_count > k_MaxTextureLayerCount) {
+            DIGNIS_LOG_ENGINE_WARN("The DDS texture has too many layers");
+            return std::nullopt;
+        }
+
+        TextureAsset texture_asset{};
+        texture_asset.m_Width         = header.Width;
+        texture_asset.m_Height        = header.Height;
+        texture_asset.m_MipLevelCount = 0 != (header.Flags & k_DDSFlagMipMapCount) ? glm::max(header.MipMapCount, 1u) : 1;
+        texture_asset.m_LayerCount    = static_cast<uint32_t>(layer_count);
+        texture_asset.m_Type          = format->first;
+        texture_asset.m_IsSRGB        = format->second;
+
+        if (texture_asset.m_MipLevelCount > std::bit_width(glm::max(header.Width, header.Height))) {
+            DIGNIS_LOG_ENGINE_WARN("The DDS texture has more mip levels than its extent allows");
+            return std::nullopt;
+        }
+
+        // The whole chain has to be there, whichever levels are kept.
+        const uint64_t data_size = texture_asset.getMipOffset(texture_asset.m_MipLevelCount);
+        if (data_offset > size || data_size > size - data_offset) {
+            DIGNIS_LOG_ENGINE_WARN("The DDS texture is truncated");
+            return std::nullopt;
+        }
+
+        texture_asset.selectMipLevels(mip_range);
+
+        const uint32_t first_mip_level = texture_asset.m_FirstMipLevel;
+        const uint32_t end_mip_level   = first_mip_level + texture_asset.m_ResidentMipLevelCount;
+
+        if (!texture_asset.allocateData(texture_asset.getMipOffset(end_mip_level), allocator))
+            return std::nullopt;
+
+        std::vector<uint64_t> mip_offsets(end_mip_level);
+        for (uint32_t mip_level = first_mip_level; mip_level < end_mip_level; mip_level++)
+            mip_offsets[mip_level] = texture_asset.getMipOffset(mip_level);
+
+        // DDS stores the whole mip chain of a layer before the next layer, ours keeps the layers of a level together.
+        const uint8_t *src = bytes.data() + data_offset;
+        for (uint32_t layer = 0; layer < texture_asset.m_LayerCount; layer++) {
+            for (uint32_t mip_level = 0; mip_level < texture_asset.m_MipLevelCount; mip_level++) {
+                const uint64_t image_size = GetImageSize(
+                    texture_asset.m_Type,
+                    texture_asset.getMipWidth(mip_level),
+                    texture_asset.getMipHeight(mip_level));
+
+                if (mip_level >= first_mip_level && mip_level < end_mip_level)
+                    memcpy(texture_asset.getMutableData().data() + mip_offsets[mip_level] + image_size * layer, src, image_size);
+                src += image_size;
+            }
+        }
 
         return texture_asset;
     }
@@ -116,7 +490,17 @@ namespace Ignis {
             case Type::eRGB32f:
             case Type::eRGB16u:
             case Type::eRGB8u:
+            case Type::eBC1:
+            case Type::eBC6H:
                 return 3;
+            case Type::eBC4:
+                return 1;
+            case Type::eBC5:
+                return 2;
+            case Type::eBC2:
+            case Type::eBC3:
+            case Type::eBC7:
+                return 4;
         }
         return 0;
     }
@@ -135,14 +519,306 @@ namespace Ignis {
                 return 4 * sizeof(uint8_t);
             case Type::eRGB8u:
                 return 3 * sizeof(uint8_t);
+            case Type::eBC1:
+            case Type::eBC2:
+            case Type::eBC3:
+            case Type::eBC4:
+            case Type::eBC5:
+            case Type::eBC6H:
+            case Type::eBC7:
+                // Block-compressed texels have no size of their own, see GetBlockSize.
+                return 0;
         }
         return 0;
     }
 
+    bool TextureAsset::IsBlockCompressed(const Type type) {
+        return 0 != GetBlockSize(type);
+    }
+
+    uint32_t TextureAsset::GetBlockSize(const Type type) {
+        switch (type) {
+            case Type::eBC1:
+            case Type::eBC4:
+                return 8;
+            case Type::eBC2:
+            case Type::eBC3:
+            case Type::eBC5:
+            case Type::eBC6H:
+            case Type::eBC7:
+                return 16;
+            default:
+                return 0;
+        }
+    }
+
+    uint64_t TextureAsset::GetImageSize(const Type type, const uint32_t width, const uint32_t height) {
+        if (IsBlockCompressed(type)) {
+            const uint64_t block_count_x = (width + BlockCompressor::k_BlockDimension - 1) / BlockCompressor::k_BlockDimension;
+            const uint64_t block_count_y = (height + BlockCompressor::k_BlockDimension - 1) / BlockCompressor::k_BlockDimension;
+            return block_count_x * block_count_y * GetBlockSize(type);
+        }
+
+        return static_cast<uint64_t>(width) * height * GetChannelSize(type);
+    }
+
+    vk::Format TextureAsset::GetFormat(const Type type, const bool is_srgb) {
+        switch (type) {
+            case Type::eRGBA32f:
+                return vk::Format::eR32G32B32A32Sfloat;
+            case Type::eRGB32f:
+                return vk::Format::eR32G32B32Sfloat;
+            case Type::eRGBA16u:
+                return vk::Format::eR16G16B16A16Unorm;
+            case Type::eRGB16u:
+                return vk::Format::eR16G16B16Unorm;
+            case Type::eRGBA8u:
+                return is_srgb ? vk::Format::eR8G8B8A8Srgb : vk::Format::eR8G8B8A8Unorm;
+            case Type::eRGB8u:
+                return is_srgb ? vk::Format::eR8G8B8Srgb : vk::Format::eR8G8B8Unorm;
+            case Type::eBC1:
+                return is_srgb ? vk::Format::eBc1RgbSrgbBlock : vk::Format::eBc1RgbUnormBlock;
+            case Type::eBC2:
+                return is_srgb ? vk::Format::eBc2SrgbBlock : vk::Format::eBc2UnormBlock;
+            case Type::eBC3:
+                return is_srgb ? vk::Format::eBc3SrgbBlock : vk::Format::eBc3UnormBlock;
+            case Type::eBC4:
+                return vk::Format::eBc4UnormBlock;
+            case Type::eBC5:
+                return vk::Format::eBc5UnormBlock;
+            case Type::eBC6H:
+                return vk::Format::eBc6HUfloatBlock;
+            case Type::eBC7:
+                return is_srgb ? vk::Format::eBc7SrgbBlock : vk::Format::eBc7UnormBlock;
+        }
+        return vk::Format::eUndefined;
+    }
+
     void TextureAsset::SetFlipVertically(const bool flip) {
         stbi_set_flip_vertically_on_load(flip);
     }
 
+    void TextureAsset::generateMipLevels(const bool is_srgb) {
+        DIGNIS_ASSERT(Type::eRGBA8u == m_Type, "Mip levels are only generated for eRGBA8u textures.");
+        DIGNIS_ASSERT(1 == m_MipLevelCount, "The texture already has mip levels.");
+        DIGNIS_ASSERT(1 == m_LayerCount, "Mip levels are only generated for single-layer textures.");
+
+        std::array<glm::f32, 256> to_linear{};
+        for (uint32_t i = 0; i < to_linear.size(); i++) {
+            const glm::f32 value = static_cast<glm::f32>(i) / 255.0f;
+
+            if (!is_srgb)
+                to_linear[i] = value;
+            else if (value <= 0.04045f)
+                to_linear[i] = value / 12.92f;
+            else
+                to_linear[i] = glm::pow((value + 0.055f) / 1.055f, 2.4f);
+        }
+
+        const auto to_byte = [is_srgb](const glm::f32 value) {
+            glm::f32 encoded = value;
+            if (is_srgb)
+                encoded = value <= 0.0031308f ? value * 12.92f : 1.055f * glm::pow(value, 1.0f / 2.4f) - 0.055f;
+
+            return static_cast<uint8_t>(glm::clamp(glm::round(encoded * 255.0f), 0.0f, 255.0f));
+        };
+
+        DIGNIS_ASSERT(m_ExternalData.empty(), "Only textures owning their data can grow mip levels.");
+
+        m_MipLevelCount         = std::bit_width(glm::max(m_Width, m_Height));
+        m_ResidentMipLevelCount = m_MipLevelCount;
+        m_IsSRGB                = is_srgb;
+        m_Data.resize(getMipOffset(m_MipLevelCount));
+
+        std::vector<uint32_t> rows{};
+
+        for (uint32_t mip_level = 1; mip_level < m_MipLevelCount; mip_level++) {
+            const uint32_t src_width  = getMipWidth(mip_level - 1);
+            const uint32_t src_height = getMipHeight(mip_level - 1);
+            const uint32_t dst_width  = getMipWidth(mip_level);
+            const uint32_t dst_height = getMipHeight(mip_level);
+
+            const uint8_t *src = m_Data.data() + getMipOffset(mip_level - 1);
+            uint8_t       *dst = m_Data.data() + getMipOffset(mip_level);
+
+            rows.resize(dst_height);
+            std::iota(std::begin(rows), std::end(rows), 0u);
+
+            std::for_each(
+                std::execution::par,
+                std::begin(rows), std::end(rows),
+                [&](const uint32_t y) {
+                    const uint32_t y0 = glm::min(2 * y, src_height - 1);
+                    const uint32_t y1 = glm::min(2 * y + 1, src_height - 1);
+
+                    for (uint32_t x = 0; x < dst_width; x++) {
+                        const uint32_t x0 = glm::min(2 * x, src_width - 1);
+                        const uint32_t x1 = glm::min(2 * x + 1, src_width - 1);
+
+                        const std::array<const uint8_t *, 4> texels{
+                            src + 4 * (y0 * src_width + x0),
+                            src + 4 * (y0 * src_width + x1),
+                            src + 4 * (y1 * src_width + x0),
+                            src + 4 * (y1 * src_width + x1),
+                        };
+
+                        uint8_t *dst_texel = dst + 4 * (y * dst_width + x);
+
+                        for (uint32_t c = 0; c < 3; c++) {
+                            glm::f32 sum = 0.0f;
+                            for (const uint8_t *texel : texels)
+                                sum += to_linear[texel[c]];
+
+                            dst_texel[c] = to_byte(sum * 0.25f);
+                        }
+
+                        // Alpha is always linear.
+                        uint32_t alpha = 0;
+                        for (const uint8_t *texel : texels)
+                            alpha += texel[3];
+
+                        dst_texel[3] = static_cast<uint8_t>((alpha + 2) / 4);
+                    }
+                });
+        }
+    }
+
+    TextureAsset TextureAsset::compress(const Type type, const Allocator &allocator) const {
+        DIGNIS_ASSERT(Type::eRGBA8u == m_Type, "Only eRGBA8u textures can be compressed.");
+        DIGNIS_ASSERT(IsBlockCompressed(type), "Compression needs a block-compressed type.");
+        DIGNIS_ASSERT(1 == m_LayerCount, "Only single-layer textures can be compressed.");
+        DIGNIS_ASSERT(m_ResidentMipLevelCount == m_MipLevelCount, "Only textures with every mip level resident can be compressed.");
+
+        TextureAsset texture_asset{};
+        texture_asset.m_Width                 = m_Width;
+        texture_asset.m_Height                = m_Height;
+        texture_asset.m_MipLevelCount         = m_MipLevelCount;
+        texture_asset.m_ResidentMipLevelCount = m_MipLevelCount;
+        texture_asset.m_Type                  = type;
+        texture_asset.m_IsSRGB                = m_IsSRGB;
+
+        // Blocks are encoded straight into the destination, a refused allocation leaves the texture empty.
+        if (!texture_asset.allocateData(texture_asset.getMipOffset(m_MipLevelCount), allocator))
+            return texture_asset;
+
+        const uint32_t block_size = GetBlockSize(type);
+
+        std::vector<uint32_t> block_rows{};
+
+        for (uint32_t mip_level = 0; mip_level < m_MipLevelCount; mip_level++) {
+            const uint32_t width  = getMipWidth(mip_level);
+            const uint32_t height = getMipHeight(mip_level);
+
+            const uint32_t block_count_x = (width + BlockCompressor::k_BlockDimension - 1) / BlockCompressor::k_BlockDimension;
+            const uint32_t block_count_y = (height + BlockCompressor::k_BlockDimension - 1) / BlockCompressor::k_BlockDimension;
+
+            const uint8_t *src = getData().data() + getMipOffset(mip_level);
+            uint8_t       *dst = texture_asset.getMutableData().data() + texture_asset.getMipOffset(mip_level);
+
+            block_rows.resize(block_count_y);
+            std::iota(std::begin(block_rows), std::end(block_rows), 0u);
+
+            std::for_each(
+                std::execution::par,
+                std::begin(block_rows), std::end(block_rows),
+                [&](const uint32_t block_y) {
+                    BlockCompressor::Block block{};
+
+                    for (uint32_t block_x = 0; block_x < block_count_x; block_x++) {
+                        // Blocks past the edge of a level repeat its last row and column.
+                        for (uint32_t i = 0; i < BlockCompressor::k_BlockTexelCount; i++) {
+                            const uint32_t x = glm::min(block_x * BlockCompressor::k_BlockDimension + i % BlockCompressor::k_BlockDimension, width - 1);
+                            const uint32_t y = glm::min(block_y * BlockCompressor::k_BlockDimension + i / BlockCompressor::k_BlockDimension, height - 1);
+
+                            const uint8_t *texel = src + 4 * (static_cast<uint64_t>(y) * width + x);
+                            block[i]             = glm::u8vec4{texel[0], texel[1], texel[2], texel[3]};
+                        }
+
+                        uint8_t *output = dst + static_cast<uint64_t>(block_size) * (block_y * block_count_x + block_x);
+
+                        switch (type) {
+                            case Type::eBC1:
+                                BlockCompressor::EncodeBC1(block, std::span<uint8_t, 8>{output, 8});
+                                break;
+                            case Type::eBC4:
+                                BlockCompressor::EncodeBC4(block, std::span<uint8_t, 8>{output, 8});
+                                break;
+                            case Type::eBC5:
+                                BlockCompressor::EncodeBC5(block, std::span<uint8_t, 16>{output, 16});
+                                break;
+                            case Type::eBC7:
+                                BlockCompressor::EncodeBC7(block, std::span<uint8_t, 16>{output, 16});
+                                break;
+                            default:
+                                break;
+                        }
+                    }
+                });
+        }
+
+        return texture_asset;
+    }
+
+    bool TextureAsset::saveKTX2(const std::filesystem::path &path) const {
+        DIGNIS_ASSERT(m_ResidentMipLevelCount == m_MipLevelCount, "Only textures with every mip level resident can be saved.");
+
+        const vk::Format format = GetFormat(m_Type, m_IsSRGB);
+        if (vk::Format::eUndefined == format) {
+            DIGNIS_LOG_ENGINE_WARN("The texture type has no KTX2 format: {}", static_cast<uint32_t>(m_Type));
+            return false;
+        }
+
+        KTX2Header header{};
+        header.Identifier             = k_KTX2Identifier;
+        header.VkFormat               = static_cast<uint32_t>(format);
+        header.TypeSize               = IsBlockCompressed(m_Type) ? 1 : GetChannelSize(m_Type);
+        header.PixelWidth             = m_Width;
+        header.PixelHeight            = m_Height;
+        header.PixelDepth             = 0;
+        header.LayerCount             = 1 == m_LayerCount ? 0 : m_LayerCount;
+        header.FaceCount              = 1;
+        header.LevelCount             = m_MipLevelCount;
+        header.SupercompressionScheme = static_cast<uint32_t>(KTX2Supercompression::eZstandard);
+
+        // The file is only read back by LoadKTX2FromMemory, so no data format descriptor is written.
+        std::vector<KTX2LevelIndex>       level_indices(m_MipLevelCount);
+        std::vector<std::vector<uint8_t>> levels(m_MipLevelCount);
+
+        uint64_t offset = sizeof(KTX2Header) + sizeof(KTX2LevelIndex) * m_MipLevelCount;
+
+        // KTX2 stores the smallest level first.
+        for (uint32_t mip_level = m_MipLevelCount; mip_level-- > 0;) {
+            const std::span<const uint8_t> level_data = getMipData(mip_level);
+
+            std::vector<uint8_t> &level = levels[mip_level];
+            level.resize(ZSTD_compressBound(level_data.size()));
+
+            const size_t encoded_size = ZSTD_compress(level.data(), level.size(), level_data.data(), level_data.size(), k_KTX2ZstdLevel);
+            if (ZSTD_isError(encoded_size)) {
+                DIGNIS_LOG_ENGINE_WARN("Failed to encode the KTX2 level {}", mip_level);
+                return false;
+            }
+            level.resize(encoded_size);
+
+            level_indices[mip_level] = KTX2LevelIndex{offset, encoded_size, level_data.size()};
+            offset += encoded_size;
+        }
+
+        std::ofstream ofile{path, std::ios::binary | std::ios::trunc};
+        if (!ofile.is_open()) {
+            DIGNIS_LOG_ENGINE_WARN("Failed to open a KTX2 texture for writing: '{}'", path.string());
+            return false;
+        }
+
+        ofile.write(reinterpret_cast<const char *>(&header), sizeof(KTX2Header));
+        ofile.write(reinterpret_cast<const char *>(level_indices.data()), static_cast<std::streamsize>(sizeof(KTX2LevelIndex) * level_indices.size()));
+        for (uint32_t mip_level = m_MipLevelCount; mip_level-- > 0;)
+            ofile.write(reinterpret_cast<const char *>(levels[mip_level].data()), static_cast<std::streamsize>(levels[mip_level].size()));
+        ofile.close();
+
+        return true;
+    }
+
     uint32_t TextureAsset::getWidth() const {
         return m_Width;
     }
@@ -151,11 +827,221 @@ namespace Ignis {
         return m_Height;
     }
 
+    uint32_t TextureAsset::getMipLevelCount() const {
+        return m_MipLevelCount;
+    }
+
+    uint32_t TextureAsset::getFirstMipLevel() const {
+        return m_FirstMipLevel;
+    }
+
+    uint32_t TextureAsset::getResidentMipLevelCount() const {
+        return m_ResidentMipLevelCount;
+    }
+
+    uint32_t TextureAsset::getLayerCount() const {
+        return m_LayerCount;
+    }
+
+    uint32_t TextureAsset::getMipWidth(const uint32_t mip_level) const {
+        return glm::max(m_Width >> mip_level, 1u);
+    }
+
+    uint32_t TextureAsset::getMipHeight(const uint32_t mip_level) const {
+        return glm::max(m_Height >> mip_level, 1u);
+    }
+
+    uint64_t TextureAsset::getMipOffset(const uint32_t mip_level) const {
+        DIGNIS_ASSERT(mip_level >= m_FirstMipLevel);
+
+        uint64_t offset = 0;
+        for (uint32_t i = m_FirstMipLevel; i < mip_level; i++)
+            offset += GetImageSize(m_Type, getMipWidth(i), getMipHeight(i)) * m_LayerCount;
+        return offset;
+    }
+
     TextureAsset::Type TextureAsset::getType() const {
         return m_Type;
     }
 
+    bool TextureAsset::isSRGB() const {
+        return m_IsSRGB;
+    }
+
     std::span<const uint8_t> TextureAsset::getData() const {
+        if (!m_ExternalData.empty())
+            return m_ExternalData;
+        return m_Data;
+    }
+
+    std::span<const uint8_t> TextureAsset::getMipData(const uint32_t mip_level) const {
+        DIGNIS_ASSERT(mip_level >= m_FirstMipLevel && mip_level < m_FirstMipLevel + m_ResidentMipLevelCount);
+        return getData().subspan(
+            getMipOffset(mip_level),
+            GetImageSize(m_Type, getMipWidth(mip_level), getMipHeight(mip_level)) * m_LayerCount);
+    }
+
+    bool TextureAsset::allocateData(const uint64_t size, const Allocator &allocator) {
+        m_Data.clear();
+
+        if (!allocator) {
+            m_Data.resize(size);
+            return true;
+        }
+
+        m_ExternalData = allocator(*this, size);
+        if (m_ExternalData.size() < size) {
+            DIGNIS_LOG_ENGINE_WARN("The texture allocator refused {} bytes", size);
+            m_ExternalData = {};
+            return false;
+        }
+
+        m_ExternalData = m_ExternalData.first(size);
+        return true;
+    }
+
+    void TextureAsset::selectMipLevels(const MipRange &mip_range) {
+        uint32_t first_mip_level = glm::min(mip_range.First, m_MipLevelCount - 1);
+        while (first_mip_level + 1 < m_MipLevelCount &&
+               glm::max(getMipWidth(first_mip_level), getMipHeight(first_mip_level)) > mip_range.MaxExtent)
+            first_mip_level++;
+
+        m_FirstMipLevel         = first_mip_level;
+        m_ResidentMipLevelCount = glm::clamp(mip_range.Count, 1u, m_MipLevelCount - first_mip_level);
+    }
+
+    std::span<uint8_t> TextureAsset::getMutableData() {
+        if (!m_ExternalData.empty())
+            return m_ExternalData;
         return m_Data;
     }
+
+    template <typename T>
+    bool ReadStruct(const std::span<const uint8_t> bytes, const uint64_t offset, T &value) {
+        if (offset > bytes.size() || sizeof(T) > bytes.size() - offset)
+            return false;
+
+        memcpy(&value, bytes.data() + offset, sizeof(T));
+        return true;
+    }
+
+    std::optional<std::pair<TextureAsset::Type, bool>> TranslateVkFormat(const vk::Format format) {
+        using Type = TextureAsset::Type;
+
+        switch (format) {
+            case vk::Format::eR8G8B8A8Unorm:
+                return std::pair{Type::eRGBA8u, false};
+            case vk::Format::eR8G8B8A8Srgb:
+                return std::pair{Type::eRGBA8u, true};
+            case vk::Format::eR16G16B16A16Unorm:
+                return std::pair{Type::eRGBA16u, false};
+            case vk::Format::eR32G32B32A32Sfloat:
+                return std::pair{Type::eRGBA32f, false};
+            case vk::Format::eBc1RgbUnormBlock:
+            case vk::Format::eBc1RgbaUnormBlock:
+                return std::pair{Type::eBC1, false};
+            case vk::Format::eBc1RgbSrgbBlock:
+            case vk::Format::eBc1RgbaSrgbBlock:
+                return std::pair{Type::eBC1, true};
+            case vk::Format::eBc2UnormBlock:
+                return std::pair{Type::eBC2, false};
+            case vk::Format::eBc2SrgbBlock:
+                return std::pair{Type::eBC2, true};
+            case vk::Format::eBc3UnormBlock:
+                return std::pair{Type::eBC3, false};
+            case vk::Format::eBc3SrgbBlock:
+                return std::pair{Type::eBC3, true};
+            case vk::Format::eBc4UnormBlock:
+                return std::pair{Type::eBC4, false};
+            case vk::Format::eBc5UnormBlock:
+                return std::pair{Type::eBC5, false};
+            case vk::Format::eBc6HUfloatBlock:
+                return std::pair{Type::eBC6H, false};
+            case vk::Format::eBc7UnormBlock:
+                return std::pair{Type::eBC7, false};
+            case vk::Format::eBc7SrgbBlock:
+                return std::pair{Type::eBC7, true};
+            default:
+                return std::nullopt;
+        }
+    }
+
+    std::optional<std::pair<TextureAsset::Type, bool>> TranslateDXGIFormat(const uint32_t dxgi_format) {
+        using Type = TextureAsset::Type;
+
+        // Values of DXGI_FORMAT.
+        switch (dxgi_format) {
+            case 2:
+                return std::pair{Type::eRGBA32f, false};
+            case 11:
+                return std::pair{Type::eRGBA16u, false};
+            case 28:
+                return std::pair{Type::eRGBA8u, false};
+            case 29:
+                return std::pair{Type::eRGBA8u, true};
+            case 71:
+                return std::pair{Type::eBC1, false};
+            case 72:
+                return std::pair{Type::eBC1, true};
+            case 74:
+                return std::pair{Type::eBC2, false};
+            case 75:
+                return std::pair{Type::eBC2, true};
+            case 77:
+                return std::pair{Type::eBC3, false};
+            case 78:
+                return std::pair{Type::eBC3, true};
+            case 80:
+                return std::pair{Type::eBC4, false};
+            case 83:
+                return std::pair{Type::eBC5, false};
+            case 95:
+                return std::pair{Type::eBC6H, false};
+            case 98:
+                return std::pair{Type::eBC7, false};
+            case 99:
+                return std::pair{Type::eBC7, true};
+            default:
+                return std::nullopt;
+        }
+    }
+
+    std::optional<std::pair<TextureAsset::Type, bool>> TranslateDDSPixelFormat(const DDSPixelFormat &pixel_format) {
+        using Type = TextureAsset::Type;
+
+        // Legacy headers carry no color space, everything is treated as linear.
+        if (0 != (pixel_format.Flags & k_DDSPixelFormatFourCC)) {
+            switch (pixel_format.FourCC) {
+                case MakeFourCC('D', 'X', 'T', '1'):
+                    return std::pair{Type::eBC1, false};
+                case MakeFourCC('D', 'X', 'T', '2'):
+                case MakeFourCC('D', 'X', 'T', '3'):
+                    return std::pair{Type::eBC2, false};
+                case MakeFourCC('D', 'X', 'T', '4'):
+                case MakeFourCC('D', 'X', 'T', '5'):
+                    return std::pair{Type::eBC3, false};
+                case MakeFourCC('A', 'T', 'I', '1'):
+                case MakeFourCC('B', 'C', '4', 'U'):
+                    return std::pair{Type::eBC4, false};
+                case MakeFourCC('A', 'T', 'I', '2'):
+                case MakeFourCC('B', 'C', '5', 'U'):
+                    return std::pair{Type::eBC5, false};
+                // D3DFMT_A16B16G16R16 and D3DFMT_A32B32G32R32F.
+                case 36:
+                    return std::pair{Type::eRGBA16u, false};
+                case 116:
+                    return std::pair{Type::eRGBA32f, false};
+                default:
+                    return std::nullopt;
+            }
+        }
+
+        if (0 != (pixel_format.Flags & k_DDSPixelFormatRGB) && 32 == pixel_format.RGBBitCount &&
+            0x000000FF == pixel_format.RBitMask &&
+            0x0000FF00 == pixel_format.GBitMask &&
+            0x00FF0000 == pixel_format.BBitMask)
+            return std::pair{Type::eRGBA8u, false};
+
+        return std::nullopt;
+    }
 }  // namespace Ignis
\ No newline at end of file
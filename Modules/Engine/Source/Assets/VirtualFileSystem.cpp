@@ -0,0 +1,121 @@
+#include <Ignis/Assets/VirtualFileSystem.hpp>
+
+#include <assimp/MemoryIOWrapper.h>
+
+namespace Ignis {
+    // Reads straight from the bytes of a file asset and keeps them alive.
+    class FileAssetIOStream final : public Assimp::MemoryIOStream {
+       public:
+        explicit FileAssetIOStream(FileAsset file)
+            : MemoryIOStream{reinterpret_cast<const uint8_t *>(file.getBytes().data()), file.getSize()},
+              m_File{std::move(file)} {}
+
+       private:
+        FileAsset m_File;
+    };
+
+    std::vector<VirtualFileSystem::MountedPak> VirtualFileSystem::s_Mounts{};
+    std::shared_mutex                          VirtualFileSystem::s_MountsMutex{};
+
+    std::string NormalizeVirtualPath(const std::filesystem::path &path);
+
+    bool VirtualFileSystem::Mount(const std::filesystem::path &pak_path, const std::filesystem::path &mount_point) {
+        std::optional<std::unique_ptr<PakArchive>> pak_archive = PakArchive::Open(pak_path);
+        if (!pak_archive.has_value())
+            return false;
+
+        MountedPak mounted_pak{};
+        mounted_pak.MountPoint = NormalizeVirtualPath(mount_point);
+        mounted_pak.Archive    = std::move(pak_archive.value());
+
+        std::unique_lock lock{s_MountsMutex};
+        s_Mounts.push_back(std::move(mounted_pak));
+
+        DIGNIS_LOG_ENGINE_INFO("Mounted the pak archive '{}' at: '{}'", pak_path.string(), mount_point.string());
+
+        return true;
+    }
+
+    void VirtualFileSystem::Unmount(const std::filesystem::path &mount_point) {
+        const std::string normalized_mount_point = NormalizeVirtualPath(mount_point);
+
+        std::unique_lock lock{s_MountsMutex};
+        std::erase_if(s_Mounts, [&normalized_mount_point](const MountedPak &mounted_pak) {
+            return normalized_mount_point == mounted_pak.MountPoint;
+        });
+    }
+
+    void VirtualFileSystem::UnmountAll() {
+        std::unique_lock lock{s_MountsMutex};
+        s_Mounts.clear();
+    }
+
+    bool VirtualFileSystem::IsMounted(const std::filesystem::path &path) {
+        std::shared_lock lock{s_MountsMutex};
+        return nullptr != Resolve(path).second;
+    }
+
+    bool VirtualFileSystem::Exists(const std::filesystem::path &path) {
+        return IsMounted(path) || std::filesystem::exists(path);
+    }
+
+    std::optional<FileAsset> VirtualFileSystem::ReadMounted(const std::filesystem::path &path) {
+        std::shared_lock lock{s_MountsMutex};
+
+        const auto [pak_archive, entry] = Resolve(path);
+        if (nullptr == entry)
+            return std::nullopt;
+
+        return pak_archive->read(*entry);
+    }
+
+    std::pair<const PakArchive *, const PakArchive::Entry *> VirtualFileSystem::Resolve(const std::filesystem::path &path) {
+        if (s_Mounts.empty())
+            return {nullptr, nullptr};
+
+        const std::string normalized_path = NormalizeVirtualPath(path);
+
+        for (const MountedPak &mounted_pak : std::views::reverse(s_Mounts)) {
+            const std::string &mount_point = mounted_pak.MountPoint;
+
+            if (normalized_path.size() <= mount_point.size() ||
+                !normalized_path.starts_with(mount_point) ||
+                '/' != normalized_path[mount_point.size()])
+                continue;
+
+            const std::string_view name = std::string_view{normalized_path}.substr(mount_point.size() + 1);
+            if (const PakArchive::Entry *entry = mounted_pak.Archive->find(name); nullptr != entry)
+                return {mounted_pak.Archive.get(), entry};
+        }
+
+        return {nullptr, nullptr};
+    }
+
+    bool VirtualIOSystem::Exists(const char *file) const {
+        return VirtualFileSystem::IsMounted(file) || DefaultIOSystem::Exists(file);
+    }
+
+    Assimp::IOStream *VirtualIOSystem::Open(const char *file, const char *mode) {
+        // Reads go through file assets, so files on disk are mapped and mounted files come from their pak.
+        if (nullptr == std::strchr(mode, 'w') && nullptr == std::strchr(mode, 'a') && VirtualFileSystem::Exists(file)) {
+            if (std::optional<FileAsset> file_asset = FileAsset::LoadBinaryFromPath(file); file_asset.has_value())
+                return new FileAssetIOStream{std::move(file_asset.value())};
+        }
+
+        return DefaultIOSystem::Open(file, mode);
+    }
+
+    std::string NormalizeVirtualPath(const std::filesystem::path &path) {
+        std::error_code error{};
+
+        std::filesystem::path absolute_path = std::filesystem::absolute(path, error);
+        if (error)
+            absolute_path = path;
+
+        std::string normalized_path = absolute_path.lexically_normal().generic_string();
+        while (normalized_path.size() > 1 && normalized_path.ends_with('/'))
+            normalized_path.pop_back();
+
+        return normalized_path;
+    }
+}  // namespace Ignis
@@ -15,6 +15,9 @@ namespace Ignis {
 
         m_IsRunning.store(false);
 
+        for (const VirtualFileSystem::PakMount &pak_mount : settings.PakMounts)
+            VirtualFileSystem::Mount(pak_mount.PakPath, pak_mount.MountPoint);
+
         m_Window.initialize(settings.WindowSettings);
         m_Vulkan.initialize(settings.VulkanSettings);
         m_Frame.initialize(settings.FrameSettings);
@@ -53,6 +56,8 @@ namespace Ignis {
         m_Vulkan.shutdown();
         m_Window.shutdown();
 
+        VirtualFileSystem::UnmountAll();
+
         DIGNIS_LOG_ENGINE_INFO("Ignis::Engine Shutdown");
 
         s_pInstance = nullptr;
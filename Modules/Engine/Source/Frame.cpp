@@ -88,6 +88,16 @@ namespace Ignis {
         return m_FrameGraph;
     }
 
+    uint32_t Frame::getFrameIndex() const {
+        DIGNIS_ASSERT(nullptr != s_pInstance, "Ignis::Frame is not initialized.");
+        return m_FrameIndex;
+    }
+
+    uint32_t Frame::getFramesInFlight() const {
+        DIGNIS_ASSERT(nullptr != s_pInstance, "Ignis::Frame is not initialized.");
+        return m_FramesInFlight;
+    }
+
     Frame::Data &Frame::getCurrentFrameDataRef() {
         DIGNIS_ASSERT(nullptr != s_pInstance, "Ignis::Frame is not initialized.");
         return m_Frames[s_pInstance->m_FrameIndex];
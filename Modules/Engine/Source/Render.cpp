@@ -17,6 +17,7 @@ namespace Ignis {
 
         s_pInstance->setSkyboxViewport(color_image, depth_image);
         s_pInstance->setModelViewport(color_image, depth_image);
+        s_pInstance->setCullViewport(depth_image);
     }
 
     void Render::SetCamera(const Camera &camera) {
@@ -80,12 +81,35 @@ namespace Ignis {
                 .setAnisotropyEnable(vk::True)
                 .setMaxAnisotropy(16.0f));
 
+        // Material textures carry full mip chains, the views bound the LOD range to the levels that exist.
+        // Streamed textures are bound to images holding only their resident levels, so one sampler serves them all.
+        m_TextureSampler = Vulkan::CreateSampler(
+            vk::SamplerCreateInfo()
+                .setMagFilter(vk::Filter::eLinear)
+                .setMinFilter(vk::Filter::eLinear)
+                .setMipmapMode(vk::SamplerMipmapMode::eLinear)
+                .setAddressModeU(vk::SamplerAddressMode::eRepeat)
+                .setAddressModeV(vk::SamplerAddressMode::eRepeat)
+                .setAddressModeW(vk::SamplerAddressMode::eRepeat)
+                .setMinLod(0.0f)
+                .setMaxLod(vk::LodClampNone)
+                .setAnisotropyEnable(vk::True)
+                .setMaxAnisotropy(16.0f));
+
         m_Camera = Camera{glm::mat4x4{1.0f}, glm::mat4x4{1.0f}, glm::vec3{0.0f}};
 
+        if (!settings.AssetCacheDirectory.empty())
+            m_AssetDatabase = AssetDatabase::Open(settings.AssetRootDirectory, settings.AssetCacheDirectory);
+
+        initializeUploads(settings);
+        initializeStreaming(settings);
+        initializeGeometry(settings);
         initializeSkybox(settings);
         initializeMaterials(settings.MaxBindingCount);
-        initializeLights();
-        initializeModels(settings.MaxBindingCount);
+        initializeLights(settings.MaxBindingCount);
+        initializeModels(settings);
+        initializeDraws(settings);
+        initializeCulling(settings);
 
         s_pInstance = this;
         DIGNIS_LOG_ENGINE_INFO("Ignis::Render Initialized");
@@ -94,14 +118,22 @@ namespace Ignis {
     void Render::shutdown() {
         DIGNIS_ASSERT(nullptr != s_pInstance, "Ignis::Render is not initialized.");
 
+        releaseCulling();
         releaseModels();
+        releaseDraws();
         releaseLights();
         releaseMaterials();
         releaseSkybox();
+        releaseGeometry();
+        releaseStreaming();
+        releaseUploads();
 
+        Vulkan::DestroySampler(m_TextureSampler);
         Vulkan::DestroySampler(m_Sampler);
         Vulkan::DestroyDescriptorPool(m_DescriptorPool);
 
+        m_AssetDatabase.reset();
+
         m_pFrameGraph = nullptr;
 
         DIGNIS_LOG_ENGINE_INFO("Ignis::Render Shutdown");
@@ -109,34 +141,41 @@ namespace Ignis {
     }
 
     void Render::onRender(FrameGraph &frame_graph) {
-        FrameGraph::RenderPass model_render_pass{
-            "Ignis::Render::Model Pass",
-            {1.0f, 0.0f, 0.0f, 1.0f},
-        };
+        recyclePages(m_InstancePages);
 
-        model_render_pass
-            .setColorAttachments(FrameGraph::Attachment{
-                m_ColorImage,
-                vk::ClearColorValue{0.0f, 0.0f, 0.0f, 1.0f},
-                vk::AttachmentLoadOp::eClear,
-                vk::AttachmentStoreOp::eStore,
-            })
-            .setDepthAttachment(FrameGraph::Attachment{
-                m_DepthImage,
-                vk::ClearDepthStencilValue{1.0f},
-                vk::AttachmentLoadOp::eClear,
-                vk::AttachmentStoreOp::eStore,
-            })
-            .setExecute([this](const vk::CommandBuffer command_buffer) {
-                onModelDraw(command_buffer);
-            });
+        sortDraws();
+
+        // CPU culling queues its results as uploads, GPU culling reads the uploaded draws and their instance offsets.
+        if (CullingMode::eCPU == m_CullingMode)
+            cullInstances();
+        else
+            updateCullDrawOffsets();
 
-        readMaterialImages(model_render_pass);
-        readMaterialBuffers(model_render_pass);
-        readLightBuffers(model_render_pass);
-        readModelBuffers(model_render_pass);
+        updateLightClusters();
+
+        // Rebuilt texture images are filled before the upload pass binds them.
+        recordTextureStreaming(frame_graph);
+        recordUploads(frame_graph);
+        recordLightCulling(frame_graph);
+
+        const bool occlusion_culling =
+            CullingMode::eGPU == m_CullingMode &&
+            m_OcclusionCulling &&
+            FrameGraph::k_InvalidImageID != m_FrameGraphDepthPyramid;
+
+        if (CullingMode::eGPU == m_CullingMode)
+            recordCulling(frame_graph, occlusion_culling ? CullPhase::eEarly : CullPhase::eAll);
+
+        recordModelPass(frame_graph, vk::AttachmentLoadOp::eClear);
+
+        if (occlusion_culling) {
+            recordDepthPyramid(frame_graph);
+            recordCulling(frame_graph, CullPhase::eLate);
+
+            recordModelPass(frame_graph, vk::AttachmentLoadOp::eLoad);
+        }
 
-        frame_graph.addRenderPass(model_render_pass);
+        recordTextureFeedback(frame_graph);
 
         FrameGraph::RenderPass skybox_render_pass{
             "Ignis::Render::Skybox Pass",
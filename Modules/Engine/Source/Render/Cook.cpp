@@ -0,0 +1,871 @@
+#include <Ignis/Render.hpp>
+
+namespace Ignis {
+    struct CookedModelHeader {
+        uint32_t Magic;
+        uint32_t Version;
+        uint32_t VertexSize;
+        uint32_t MeshSize;
+
+        uint64_t SourceSize;
+        int64_t  SourceWriteTime;
+
+        uint32_t VertexCount;
+        uint32_t IndexCount;
+        uint32_t MeshCount;
+        uint32_t MaterialCount;
+        uint32_t TextureCount;
+        uint32_t _ignis_padding;
+
+        std::array<glm::f32, 4> BoundsMin;
+        std::array<glm::f32, 4> BoundsMax;
+        std::array<glm::f32, 4> BoundingSphere;
+
+        uint64_t VertexOffset;
+        uint64_t IndexOffset;
+        uint64_t MeshOffset;
+        uint64_t IndirectCommandOffset;
+        uint64_t RecordOffset;
+    };
+
+    struct CookedMaterialRecord {
+        uint32_t Index;
+
+        std::array<glm::f32, 3> AlbedoFactor;
+        glm::f32                MetallicFactor;
+        std::array<glm::f32, 3> EmissiveFactor;
+        glm::f32                RoughnessFactor;
+
+        std::array<uint32_t, Render::k_TextureRoleCount> Textures;
+    };
+
+    // A mesh instance found by the node walk, with the slices of the shared arrays its import job writes.
+    struct MeshImport {
+        const aiMesh *Mesh;
+        glm::mat4x4   Transform;
+
+        uint32_t VertexOffset;
+        uint32_t IndexOffset;
+        uint32_t IndexCount;
+    };
+
+    struct SMikkTSpaceMesh {
+        uint32_t IndexCount = 0;
+
+        uint32_t       *Indices  = nullptr;
+        Render::Vertex *Vertices = nullptr;
+    };
+
+    // Bulk arrays start on this boundary, so a mapped cooked file can be read in place.
+    constexpr uint64_t k_CookedModelAlignment = 16;
+
+    class CookedModelWriter {
+       public:
+        template <typename T>
+        uint64_t write(const T &value) {
+            return write(&value, sizeof(T));
+        }
+
+        uint64_t write(const void *data, const uint64_t size) {
+            const uint64_t offset = m_Bytes.size();
+            m_Bytes.append(static_cast<const char *>(data), size);
+            return offset;
+        }
+
+        void writeString(const std::string_view string) {
+            write(static_cast<uint32_t>(string.size()));
+            write(string.data(), string.size());
+        }
+
+        void align() {
+            m_Bytes.resize((m_Bytes.size() + k_CookedModelAlignment - 1) / k_CookedModelAlignment * k_CookedModelAlignment, '\0');
+        }
+
+        template <typename T>
+        void overwrite(const uint64_t offset, const T &value) {
+            memcpy(m_Bytes.data() + offset, &value, sizeof(T));
+        }
+
+        std::string &getBytes() {
+            return m_Bytes;
+        }
+
+       private:
+        std::string m_Bytes{};
+    };
+
+    // Records every file the importer opens, so cooks know what a model was built from.
+    class RecordingIOSystem final : public VirtualIOSystem {
+       public:
+        explicit RecordingIOSystem(std::vector<std::filesystem::path> &paths)
+            : m_Paths{paths} {}
+
+        Assimp::IOStream *Open(const char *file, const char *mode) override {
+            Assimp::IOStream *stream = VirtualIOSystem::Open(file, mode);
+
+            if (nullptr != stream && std::ranges::find(m_Paths, std::filesystem::path{file}) == std::end(m_Paths))
+                m_Paths.emplace_back(file);
+
+            return stream;
+        }
+
+       private:
+        std::vector<std::filesystem::path> &m_Paths;
+    };
+
+    class CookedModelReader {
+       public:
+        explicit CookedModelReader(const std::span<const uint8_t> bytes)
+            : m_Bytes{bytes} {}
+
+        template <typename T>
+        bool read(T &value) {
+            std::span<const uint8_t> bytes{};
+            if (!readBytes(sizeof(T), bytes))
+                return false;
+
+            memcpy(&value, bytes.data(), sizeof(T));
+            return true;
+        }
+
+        bool readBytes(const uint64_t size, std::span<const uint8_t> &bytes) {
+            if (size > m_Bytes.size() - m_Offset)
+                return false;
+
+            bytes = m_Bytes.subspan(m_Offset, size);
+            m_Offset += size;
+            return true;
+        }
+
+        bool readString(std::string &string) {
+            uint32_t                 size = 0;
+            std::span<const uint8_t> bytes{};
+            if (!read(size) || !readBytes(size, bytes))
+                return false;
+
+            string.assign(reinterpret_cast<const char *>(bytes.data()), bytes.size());
+            return true;
+        }
+
+        bool seek(const uint64_t offset) {
+            if (offset > m_Bytes.size())
+                return false;
+
+            m_Offset = offset;
+            return true;
+        }
+
+       private:
+        std::span<const uint8_t> m_Bytes;
+
+        uint64_t m_Offset = 0;
+    };
+
+    void ImportNode(
+        const aiScene     *ai_scene,
+        const aiNode      *ai_node,
+        const glm::mat4x4 &transform,
+
+        std::vector<MeshImport> &mesh_imports);
+
+    void ImportMesh(
+        const MeshImport &mesh_import,
+
+        std::span<Render::Vertex>       vertices,
+        std::span<uint32_t>             indices,
+        Render::Mesh                   &mesh,
+        vk::DrawIndexedIndirectCommand &indirect_command);
+
+    Render::CookedMaterial ImportMaterial(
+        const aiScene    *ai_scene,
+        const aiMaterial *ai_material,
+        uint32_t          ai_material_index,
+
+        std::vector<Render::CookedTexture>        &textures,
+        gtl::flat_hash_map<std::string, uint32_t> &texture_indices);
+
+    uint32_t ImportTexture(
+        const aiScene    *ai_scene,
+        const aiMaterial *ai_material,
+        aiTextureType     ai_texture_type,
+
+        std::vector<Render::CookedTexture>        &textures,
+        gtl::flat_hash_map<std::string, uint32_t> &texture_indices);
+
+    std::optional<Render::CookedModel> ParseCookedModel(FileAsset file);
+
+    uint64_t GetSourceSize(const std::filesystem::path &path);
+    int64_t  GetSourceWriteTime(const std::filesystem::path &path);
+
+    int32_t GetSMikkTSpaceNumFaces(const SMikkTSpaceContext *context);
+    int32_t GetSMikkTSpaceNumVerticesPerFace(const SMikkTSpaceContext *context, int32_t i_face);
+
+    void GetSMikkTSpacePosition(const SMikkTSpaceContext *context, glm::f32 o_fv_position[3], int32_t i_face, int32_t i_vertex);
+    void GetSMikkTSpaceNormal(const SMikkTSpaceContext *context, glm::f32 o_fv_normal[3], int32_t i_face, int32_t i_vertex);
+    void GetSMikkTSpaceUV(const SMikkTSpaceContext *context, glm::f32 o_fv_uv[2], int32_t i_face, int32_t i_vertex);
+
+    void SetSMikkTSpaceBasic(const SMikkTSpaceContext *context, const glm::f32 fv_tangent[3], glm::f32 f_sign, int32_t i_face, int32_t i_vertex);
+
+    SMikkTSpaceInterface g_SMikkTSpaceInterface{
+        .m_getNumFaces          = GetSMikkTSpaceNumFaces,
+        .m_getNumVerticesOfFace = GetSMikkTSpaceNumVerticesPerFace,
+        .m_getPosition          = GetSMikkTSpacePosition,
+        .m_getNormal            = GetSMikkTSpaceNormal,
+        .m_getTexCoord          = GetSMikkTSpaceUV,
+        .m_setTSpaceBasic       = SetSMikkTSpaceBasic,
+        .m_setTSpace            = nullptr,
+    };
+
+    std::optional<Render::CookedModel> Render::ImportModel(const std::filesystem::path &path) {
+        const std::string spath = path.string();
+
+        if (!VirtualFileSystem::Exists(path)) {
+            DIGNIS_LOG_ENGINE_WARN("Failed to find a model from path: '{}'", spath);
+            return std::nullopt;
+        }
+
+        std::vector<std::filesystem::path> source_files{path};
+
+        Assimp::Importer importer{};
+        // The importer owns its IO system.
+        importer.SetIOHandler(new RecordingIOSystem{source_files});
+
+        const aiScene *ai_scene =
+            importer.ReadFile(
+                spath,
+                // aiProcess_CalcTangentSpace |
+                aiProcess_Triangulate |
+                    aiProcess_GenNormals |
+                    aiProcess_GenUVCoords |
+                    aiProcess_OptimizeMeshes |
+                    aiProcess_OptimizeGraph |
+                    aiProcess_JoinIdenticalVertices |
+                    aiProcess_FixInfacingNormals |
+                    aiProcess_RemoveRedundantMaterials |
+                    aiProcess_FindDegenerates |
+                    aiProcess_FindInvalidData |
+                    aiProcess_ImproveCacheLocality |
+                    aiProcess_ValidateDataStructure |
+                    aiProcess_FlipUVs);
+        if (nullptr == ai_scene) {
+            DIGNIS_LOG_ENGINE_WARN("Failed to load asset from path: '{}'. Assimp error: '{}'", spath, importer.GetErrorString());
+            return std::nullopt;
+        }
+        DIGNIS_LOG_ENGINE_INFO("Loaded an Ignis::AssimpAsset from path: '{}'", spath);
+
+        std::vector<MeshImport> mesh_imports{};
+
+        ImportNode(ai_scene, ai_scene->mRootNode, glm::mat4x4{1.0f}, mesh_imports);
+
+        // Meshes are laid out in node order before any is converted, so the jobs write disjoint slices and the cooked
+        // bytes do not depend on how they are scheduled.
+        uint32_t vertex_count = 0;
+        uint32_t index_count  = 0;
+        for (MeshImport &mesh_import : mesh_imports) {
+            mesh_import.VertexOffset = vertex_count;
+            mesh_import.IndexOffset  = index_count;
+            for (uint32_t i = 0; i < mesh_import.Mesh->mNumFaces; i++)
+                mesh_import.IndexCount += mesh_import.Mesh->mFaces[i].mNumIndices;
+
+            vertex_count += mesh_import.Mesh->mNumVertices;
+            index_count += mesh_import.IndexCount;
+        }
+
+        std::vector<Vertex>   vertices(vertex_count);
+        std::vector<uint32_t> indices(index_count);
+        std::vector<Mesh>     meshes(mesh_imports.size());
+
+        std::vector<vk::DrawIndexedIndirectCommand> indirect_commands(mesh_imports.size());
+
+        // Conversion and tangent generation are independent per mesh, each runs as its own job.
+        std::for_each(
+            std::execution::par,
+            std::begin(mesh_imports), std::end(mesh_imports),
+            [&](const MeshImport &mesh_import) {
+                const uint64_t index = &mesh_import - mesh_imports.data();
+
+                ImportMesh(
+                    mesh_import,
+                    std::span{vertices}.subspan(mesh_import.VertexOffset, mesh_import.Mesh->mNumVertices),
+                    std::span{indices}.subspan(mesh_import.IndexOffset, mesh_import.IndexCount),
+                    meshes[index],
+                    indirect_commands[index]);
+            });
+
+        std::vector<CookedMaterial> materials{};
+        std::vector<CookedTexture>  textures{};
+
+        gtl::flat_hash_map<std::string, uint32_t> texture_indices{};
+
+        for (uint32_t i = 0; i < ai_scene->mNumMaterials; i++)
+            materials.push_back(ImportMaterial(ai_scene, ai_scene->mMaterials[i], i, textures, texture_indices));
+
+        // Model bounds enclose every mesh after its node transform, in model space.
+        glm::vec3 bounds_min{std::numeric_limits<glm::f32>::max()};
+        glm::vec3 bounds_max{std::numeric_limits<glm::f32>::lowest()};
+        for (const Mesh &mesh : meshes) {
+            for (uint32_t i = 0; i < 8; i++) {
+                const glm::vec3 corner{
+                    (i & 1) ? mesh.BoundsMax.x : mesh.BoundsMin.x,
+                    (i & 2) ? mesh.BoundsMax.y : mesh.BoundsMin.y,
+                    (i & 4) ? mesh.BoundsMax.z : mesh.BoundsMin.z,
+                };
+                const glm::vec3 position = mesh.VertexTransform * glm::vec4{corner, 1.0f};
+
+                bounds_min = glm::min(bounds_min, position);
+                bounds_max = glm::max(bounds_max, position);
+            }
+        }
+        if (meshes.empty()) {
+            bounds_min = glm::vec3{0.0f};
+            bounds_max = glm::vec3{0.0f};
+        }
+
+        const glm::vec3 bounds_center = (bounds_min + bounds_max) * 0.5f;
+
+        glm::f32 bounds_radius = 0.0f;
+        for (const Mesh &mesh : meshes) {
+            const glm::vec3 center = mesh.VertexTransform * glm::vec4{glm::vec3{mesh.BoundingSphere}, 1.0f};
+            const glm::f32  scale  = glm::max(
+                glm::length(glm::vec3{mesh.VertexTransform[0]}),
+                glm::max(glm::length(glm::vec3{mesh.VertexTransform[1]}), glm::length(glm::vec3{mesh.VertexTransform[2]})));
+
+            bounds_radius = glm::max(bounds_radius, glm::distance(bounds_center, center) + mesh.BoundingSphere.w * scale);
+        }
+
+        CookedModelHeader header{};
+        header.Magic           = k_CookedModelMagic;
+        header.Version         = k_CookedModelVersion;
+        header.VertexSize      = sizeof(Vertex);
+        header.MeshSize        = sizeof(Mesh);
+        header.SourceSize      = GetSourceSize(path);
+        header.SourceWriteTime = GetSourceWriteTime(path);
+        header.VertexCount     = static_cast<uint32_t>(vertices.size());
+        header.IndexCount      = static_cast<uint32_t>(indices.size());
+        header.MeshCount       = static_cast<uint32_t>(meshes.size());
+        header.MaterialCount   = static_cast<uint32_t>(materials.size());
+        header.TextureCount    = static_cast<uint32_t>(textures.size());
+        header.BoundsMin       = {bounds_min.x, bounds_min.y, bounds_min.z, 0.0f};
+        header.BoundsMax       = {bounds_max.x, bounds_max.y, bounds_max.z, 0.0f};
+        header.BoundingSphere  = {bounds_center.x, bounds_center.y, bounds_center.z, bounds_radius};
+
+        CookedModelWriter writer{};
+        writer.write(header);
+
+        writer.align();
+        header.VertexOffset = writer.write(vertices.data(), sizeof(Vertex) * vertices.size());
+        writer.align();
+        header.IndexOffset = writer.write(indices.data(), sizeof(uint32_t) * indices.size());
+        writer.align();
+        header.MeshOffset = writer.write(meshes.data(), sizeof(Mesh) * meshes.size());
+        writer.align();
+        header.IndirectCommandOffset = writer.write(indirect_commands.data(), sizeof(vk::DrawIndexedIndirectCommand) * indirect_commands.size());
+        writer.align();
+        header.RecordOffset = writer.getBytes().size();
+
+        for (const CookedMaterial &material : materials) {
+            CookedMaterialRecord record{};
+            record.Index           = material.Index;
+            record.AlbedoFactor    = {material.AlbedoFactor.x, material.AlbedoFactor.y, material.AlbedoFactor.z};
+            record.MetallicFactor  = material.MetallicFactor;
+            record.EmissiveFactor  = {material.EmissiveFactor.x, material.EmissiveFactor.y, material.EmissiveFactor.z};
+            record.RoughnessFactor = material.RoughnessFactor;
+            record.Textures        = material.Textures;
+
+            writer.writeString(material.Name);
+            writer.write(record);
+        }
+
+        for (const CookedTexture &texture : textures) {
+            writer.writeString(texture.Path);
+            writer.writeString(texture.Extension);
+            writer.write(static_cast<uint64_t>(texture.EmbeddedData.size()));
+            writer.write(texture.EmbeddedData.data(), texture.EmbeddedData.size());
+        }
+
+        writer.overwrite(0, header);
+
+        // Parsing the freshly cooked bytes keeps a single layout for imported and loaded models.
+        std::optional<CookedModel> cooked_model = ParseCookedModel(FileAsset::LoadFromMemory(GetCookedModelPath(path), std::move(writer.getBytes())));
+        if (cooked_model.has_value())
+            cooked_model->SourceFiles = std::move(source_files);
+
+        return cooked_model;
+    }
+
+    std::optional<Render::CookedModel> Render::LoadCookedModel(const std::filesystem::path &path) {
+        std::optional<FileAsset> file = FileAsset::LoadBinaryFromPath(path);
+        if (!file.has_value())
+            return std::nullopt;
+
+        std::optional<CookedModel> cooked_model = ParseCookedModel(std::move(file.value()));
+        if (!cooked_model.has_value())
+            DIGNIS_LOG_ENGINE_WARN("Failed to parse a cooked model from path: '{}'", path.string());
+
+        return cooked_model;
+    }
+
+    bool Render::SaveCookedModel(const CookedModel &model, const std::filesystem::path &path) {
+        const std::string_view content = model.File.getContent();
+
+        std::ofstream ofile{path, std::ios::binary | std::ios::trunc};
+        if (!ofile.is_open()) {
+            DIGNIS_LOG_ENGINE_WARN("Failed to open a cooked model for writing: '{}'", path.string());
+            return false;
+        }
+
+        ofile.write(content.data(), static_cast<std::streamsize>(content.size()));
+        ofile.close();
+
+        DIGNIS_LOG_ENGINE_INFO("Saved a cooked model to path: '{}'", path.string());
+
+        return true;
+    }
+
+    std::filesystem::path Render::GetCookedModelPath(const std::filesystem::path &source_path) {
+        std::filesystem::path cooked_path = source_path;
+        cooked_path += k_CookedModelExtension;
+        return cooked_path;
+    }
+
+    bool Render::IsCookedModelCurrent(const CookedModel &model, const std::filesystem::path &source_path) {
+        if (!std::filesystem::exists(source_path))
+            return true;
+
+        return model.SourceSize == GetSourceSize(source_path) &&
+               model.SourceWriteTime == GetSourceWriteTime(source_path);
+    }
+
+    TextureAsset Render::CompressTexture(TextureAsset &texture_asset, const TextureRole role, const TextureAsset::Allocator &allocator) {
+        // Normal maps keep two channels for BC5, single-channel maps drop to BC4.
+        TextureAsset::Type compressed_type = TextureAsset::Type::eBC7;
+        switch (role) {
+            case TextureRole::eAlbedo:
+            case TextureRole::eMetallicRoughness:
+                compressed_type = TextureAsset::Type::eBC7;
+                break;
+            case TextureRole::eEmissive:
+                compressed_type = TextureAsset::Type::eBC1;
+                break;
+            case TextureRole::eNormal:
+                compressed_type = TextureAsset::Type::eBC5;
+                break;
+            case TextureRole::eOcclusion:
+            case TextureRole::eMetallic:
+            case TextureRole::eRoughness:
+                compressed_type = TextureAsset::Type::eBC4;
+                break;
+        }
+
+        texture_asset.generateMipLevels(IsTextureRoleSRGB(role));
+        return texture_asset.compress(compressed_type, allocator);
+    }
+
+    bool Render::IsTextureRoleSRGB(const TextureRole role) {
+        return TextureRole::eAlbedo == role || TextureRole::eEmissive == role;
+    }
+
+    std::string Render::GetTextureVariant(const TextureRole role) {
+        return std::to_string(static_cast<uint32_t>(role));
+    }
+
+    std::optional<Render::CookedModel> Render::loadModel(const std::filesystem::path &path) {
+        if (k_CookedModelExtension == path.extension().string())
+            return LoadCookedModel(path);
+
+        if (m_AssetDatabase.has_value()) {
+            if (const std::optional<std::filesystem::path> cooked_path = m_AssetDatabase->findCooked(path);
+                cooked_path.has_value()) {
+                std::optional<CookedModel> cooked_model = LoadCookedModel(cooked_path.value());
+                if (cooked_model.has_value())
+                    return cooked_model;
+            }
+        }
+
+        const std::filesystem::path cooked_path = GetCookedModelPath(path);
+
+        if (VirtualFileSystem::Exists(cooked_path)) {
+            std::optional<CookedModel> cooked_model = LoadCookedModel(cooked_path);
+            if (cooked_model.has_value() && IsCookedModelCurrent(cooked_model.value(), path))
+                return cooked_model;
+
+            DIGNIS_LOG_ENGINE_INFO("The cooked model is out of date, cooking again: '{}'", cooked_path.string());
+        }
+
+        std::optional<CookedModel> cooked_model = ImportModel(path);
+        // A source served from a pak has no directory on disk to cook next to, it is cooked again on every load.
+        if (cooked_model.has_value() && !VirtualFileSystem::IsMounted(path))
+            SaveCookedModel(cooked_model.value(), cooked_path);
+
+        return cooked_model;
+    }
+
+    void ImportNode(
+        const aiScene     *ai_scene,
+        const aiNode      *ai_node,
+        const glm::mat4x4 &transform,
+
+        std::vector<MeshImport> &mesh_imports) {
+        const glm::mat4x4 node_transform = transform * AssimpToGlm(ai_node->mTransformation);
+
+        for (uint32_t i = 0; i < ai_node->mNumMeshes; i++)
+            mesh_imports.push_back(MeshImport{ai_scene->mMeshes[ai_node->mMeshes[i]], node_transform, 0, 0, 0});
+
+        for (uint32_t i = 0; i < ai_node->mNumChildren; i++)
+            ImportNode(
+                ai_scene,
+                ai_node->mChildren[i],
+                node_transform,
+                mesh_imports);
+    }
+
+    void ImportMesh(
+        const MeshImport &mesh_import,
+
+        const std::span<Render::Vertex> vertices,
+        const std::span<uint32_t>       indices,
+        Render::Mesh                   &mesh,
+        vk::DrawIndexedIndirectCommand &indirect_command) {
+        const aiMesh *ai_mesh = mesh_import.Mesh;
+
+        uint32_t index = 0;
+        for (uint32_t i = 0; i < ai_mesh->mNumFaces; i++) {
+            const aiFace &face = ai_mesh->mFaces[i];
+            for (uint32_t j = 0; j < face.mNumIndices; j++) {
+                indices[index++] = face.mIndices[j];
+            }
+        }
+
+        for (uint32_t i = 0; i < ai_mesh->mNumVertices; i++) {
+            Render::Vertex vertex{};
+
+            const auto position = AssimpToGlm(ai_mesh->mVertices[i]);
+            const auto normal   = AssimpToGlm(ai_mesh->mNormals[i]);
+            const auto uv       = AssimpToGlm(ai_mesh->mTextureCoords[0][i]);
+            // const auto tangent  = AssimpToGlm(ai_mesh->mTangents[i]);
+            constexpr auto tangent = glm::vec3{0.0f};
+
+            vertex.Position = position;
+            vertex.Normal   = normal;
+            vertex.UV       = uv;
+            vertex.Tangent  = glm::vec4{tangent, 0.0f};
+
+            vertices[i] = vertex;
+        }
+
+        SMikkTSpaceMesh s_mikk_tspace_mesh{};
+        s_mikk_tspace_mesh.IndexCount = mesh_import.IndexCount;
+        s_mikk_tspace_mesh.Indices    = indices.data();
+        s_mikk_tspace_mesh.Vertices   = vertices.data();
+
+        SMikkTSpaceContext s_mikk_tspace_context{};
+        s_mikk_tspace_context.m_pInterface = &g_SMikkTSpaceInterface;
+        s_mikk_tspace_context.m_pUserData  = &s_mikk_tspace_mesh;
+
+        genTangSpaceDefault(&s_mikk_tspace_context);
+
+        glm::vec3 bounds_min{std::numeric_limits<glm::f32>::max()};
+        glm::vec3 bounds_max{std::numeric_limits<glm::f32>::lowest()};
+        for (const Render::Vertex &vertex : vertices) {
+            bounds_min = glm::min(bounds_min, vertex.Position);
+            bounds_max = glm::max(bounds_max, vertex.Position);
+        }
+
+        const glm::vec3 bounds_center = (bounds_min + bounds_max) * 0.5f;
+
+        glm::f32 bounds_radius = 0.0f;
+        for (const Render::Vertex &vertex : vertices)
+            bounds_radius = glm::max(bounds_radius, glm::distance(bounds_center, vertex.Position));
+
+        mesh.VertexTransform = mesh_import.Transform;
+        mesh.NormalTransform = Render::GetNormalTransform(mesh_import.Transform);
+        mesh.BoundingSphere  = glm::vec4{bounds_center, bounds_radius};
+        mesh.BoundsMin       = bounds_min;
+        mesh.BoundsMax       = bounds_max;
+        mesh.Material        = Render::MaterialID{ai_mesh->mMaterialIndex};
+
+        indirect_command
+            .setFirstIndex(mesh_import.IndexOffset)
+            .setIndexCount(mesh_import.IndexCount)
+            .setVertexOffset(static_cast<int32_t>(mesh_import.VertexOffset))
+            .setFirstInstance(0)
+            .setInstanceCount(0);
+    }
+
+    Render::CookedMaterial ImportMaterial(
+        const aiScene    *ai_scene,
+        const aiMaterial *ai_material,
+        const uint32_t    ai_material_index,
+
+        std::vector<Render::CookedTexture>        &textures,
+        gtl::flat_hash_map<std::string, uint32_t> &texture_indices) {
+        aiVector3D albedo_factor;
+        aiVector3D emissive_factor;
+
+        ai_real metallic_factor;
+        ai_real roughness_factor;
+
+        if (AI_SUCCESS != ai_material->Get(AI_MATKEY_BASE_COLOR, albedo_factor))
+            if (AI_SUCCESS != ai_material->Get(AI_MATKEY_COLOR_DIFFUSE, albedo_factor))
+                albedo_factor = aiVector3D(1.0f, 1.0f, 1.0f);
+        if (AI_SUCCESS != ai_material->Get(AI_MATKEY_COLOR_EMISSIVE, emissive_factor))
+            emissive_factor = aiVector3D(0.0f, 0.0f, 0.0f);
+        if (AI_SUCCESS != ai_material->Get(AI_MATKEY_METALLIC_FACTOR, metallic_factor))
+            metallic_factor = 1.0f;
+        if (AI_SUCCESS != ai_material->Get(AI_MATKEY_ROUGHNESS_FACTOR, roughness_factor))
+            roughness_factor = 1.0f;
+
+        const auto import_texture = [&](const aiTextureType ai_texture_type) {
+            return ImportTexture(ai_scene, ai_material, ai_texture_type, textures, texture_indices);
+        };
+
+        auto albedo_texture = import_texture(aiTextureType_BASE_COLOR);
+        if (Render::k_InvalidCookedTexture == albedo_texture)
+            albedo_texture = import_texture(aiTextureType_DIFFUSE);
+
+        auto normal_texture = import_texture(aiTextureType_NORMALS);
+        if (Render::k_InvalidCookedTexture == normal_texture)
+            normal_texture = import_texture(aiTextureType_HEIGHT);
+
+        const auto metallic_roughness_texture = import_texture(aiTextureType_GLTF_METALLIC_ROUGHNESS);
+
+        auto metallic_texture  = Render::k_InvalidCookedTexture;
+        auto roughness_texture = Render::k_InvalidCookedTexture;
+        if (Render::k_InvalidCookedTexture == metallic_roughness_texture) {
+            metallic_texture  = import_texture(aiTextureType_METALNESS);
+            roughness_texture = import_texture(aiTextureType_DIFFUSE_ROUGHNESS);
+        }
+
+        Render::CookedMaterial material{};
+        material.Name            = ai_material->GetName().C_Str();
+        material.Index           = ai_material_index;
+        material.AlbedoFactor    = AssimpToGlm(albedo_factor);
+        material.MetallicFactor  = metallic_factor;
+        material.EmissiveFactor  = AssimpToGlm(emissive_factor);
+        material.RoughnessFactor = roughness_factor;
+
+        material.Textures.fill(Render::k_InvalidCookedTexture);
+        material.Textures[static_cast<uint32_t>(Render::TextureRole::eAlbedo)]            = albedo_texture;
+        material.Textures[static_cast<uint32_t>(Render::TextureRole::eEmissive)]          = import_texture(aiTextureType_EMISSIVE);
+        material.Textures[static_cast<uint32_t>(Render::TextureRole::eNormal)]            = normal_texture;
+        material.Textures[static_cast<uint32_t>(Render::TextureRole::eOcclusion)]         = import_texture(aiTextureType_AMBIENT_OCCLUSION);
+        material.Textures[static_cast<uint32_t>(Render::TextureRole::eMetallicRoughness)] = metallic_roughness_texture;
+        material.Textures[static_cast<uint32_t>(Render::TextureRole::eMetallic)]          = metallic_texture;
+        material.Textures[static_cast<uint32_t>(Render::TextureRole::eRoughness)]         = roughness_texture;
+
+        return material;
+    }
+
+    uint32_t ImportTexture(
+        const aiScene      *ai_scene,
+        const aiMaterial   *ai_material,
+        const aiTextureType ai_texture_type,
+
+        std::vector<Render::CookedTexture>        &textures,
+        gtl::flat_hash_map<std::string, uint32_t> &texture_indices) {
+        aiString ai_path{};
+
+        if (AI_SUCCESS != ai_material->GetTexture(ai_texture_type, 0, &ai_path))
+            return Render::k_InvalidCookedTexture;
+
+        const std::string texture_path = ai_path.C_Str();
+
+        if (texture_indices.contains(texture_path))
+            return texture_indices.at(texture_path);
+
+        Render::CookedTexture texture{};
+        texture.Path = texture_path;
+
+        const aiTexture *ai_texture = ai_scene->GetEmbeddedTexture(ai_path.C_Str());
+
+        // Embedded textures only carry a format hint, files are picked by their extension.
+        if (nullptr != ai_texture) {
+            if (0 != ai_texture->mHeight) {
+                DIGNIS_LOG_ENGINE_WARN("Uncompressed embedded textures are not supported: '{}'", texture_path);
+                return Render::k_InvalidCookedTexture;
+            }
+
+            texture.Extension    = FormatString(".{}", ai_texture->achFormatHint);
+            texture.EmbeddedData = std::span{reinterpret_cast<const uint8_t *>(ai_texture->pcData), ai_texture->mWidth};
+        } else {
+            texture.Extension = std::filesystem::path{texture_path}.extension().string();
+        }
+
+        std::ranges::transform(texture.Extension, std::begin(texture.Extension), [](const unsigned char c) {
+            return static_cast<char>(std::tolower(c));
+        });
+
+        const auto index = static_cast<uint32_t>(textures.size());
+        textures.push_back(texture);
+        texture_indices.emplace(texture_path, index);
+
+        return index;
+    }
+
+    std::optional<Render::CookedModel> ParseCookedModel(FileAsset file) {
+        Render::CookedModel cooked_model{};
+        cooked_model.File = std::move(file);
+
+        const std::span<const std::byte> file_bytes = cooked_model.File.getBytes();
+        const std::span<const uint8_t>   bytes{reinterpret_cast<const uint8_t *>(file_bytes.data()), file_bytes.size()};
+
+        CookedModelReader reader{bytes};
+
+        CookedModelHeader header{};
+        if (!reader.read(header) || Render::k_CookedModelMagic != header.Magic) {
+            DIGNIS_LOG_ENGINE_WARN("The data is not a cooked model");
+            return std::nullopt;
+        }
+
+        if (Render::k_CookedModelVersion != header.Version ||
+            sizeof(Render::Vertex) != header.VertexSize ||
+            sizeof(Render::Mesh) != header.MeshSize) {
+            DIGNIS_LOG_ENGINE_WARN("The cooked model was written by another version: {}", header.Version);
+            return std::nullopt;
+        }
+
+        cooked_model.SourceSize      = header.SourceSize;
+        cooked_model.SourceWriteTime = header.SourceWriteTime;
+        cooked_model.VertexCount     = header.VertexCount;
+        cooked_model.IndexCount      = header.IndexCount;
+        cooked_model.BoundsMin       = glm::vec3{header.BoundsMin[0], header.BoundsMin[1], header.BoundsMin[2]};
+        cooked_model.BoundsMax       = glm::vec3{header.BoundsMax[0], header.BoundsMax[1], header.BoundsMax[2]};
+        cooked_model.BoundingSphere  = glm::vec4{
+            header.BoundingSphere[0], header.BoundingSphere[1], header.BoundingSphere[2], header.BoundingSphere[3]};
+
+        std::span<const uint8_t> mesh_data{};
+        std::span<const uint8_t> indirect_command_data{};
+
+        // Vertices and indices stay in the file and are copied once, straight into staging memory.
+        if (!reader.seek(header.VertexOffset) ||
+            !reader.readBytes(sizeof(Render::Vertex) * header.VertexCount, cooked_model.VertexData) ||
+            !reader.seek(header.IndexOffset) ||
+            !reader.readBytes(sizeof(uint32_t) * header.IndexCount, cooked_model.IndexData) ||
+            !reader.seek(header.MeshOffset) ||
+            !reader.readBytes(sizeof(Render::Mesh) * header.MeshCount, mesh_data) ||
+            !reader.seek(header.IndirectCommandOffset) ||
+            !reader.readBytes(sizeof(vk::DrawIndexedIndirectCommand) * header.MeshCount, indirect_command_data) ||
+            !reader.seek(header.RecordOffset)) {
+            DIGNIS_LOG_ENGINE_WARN("The cooked model is truncated");
+            return std::nullopt;
+        }
+
+        cooked_model.Meshes.resize(header.MeshCount);
+        cooked_model.IndirectCommands.resize(header.MeshCount);
+
+        memcpy(cooked_model.Meshes.data(), mesh_data.data(), mesh_data.size());
+        memcpy(cooked_model.IndirectCommands.data(), indirect_command_data.data(), indirect_command_data.size());
+
+        cooked_model.Materials.resize(header.MaterialCount);
+        for (Render::CookedMaterial &material : cooked_model.Materials) {
+            CookedMaterialRecord record{};
+            if (!reader.readString(material.Name) || !reader.read(record)) {
+                DIGNIS_LOG_ENGINE_WARN("The cooked model is truncated");
+                return std::nullopt;
+            }
+
+            material.Index           = record.Index;
+            material.AlbedoFactor    = glm::vec3{record.AlbedoFactor[0], record.AlbedoFactor[1], record.AlbedoFactor[2]};
+            material.MetallicFactor  = record.MetallicFactor;
+            material.EmissiveFactor  = glm::vec3{record.EmissiveFactor[0], record.EmissiveFactor[1], record.EmissiveFactor[2]};
+            material.RoughnessFactor = record.RoughnessFactor;
+            material.Textures        = record.Textures;
+
+            for (const uint32_t texture : material.Textures) {
+                if (Render::k_InvalidCookedTexture != texture && texture >= header.TextureCount) {
+                    DIGNIS_LOG_ENGINE_WARN("The cooked model references a missing texture: {}", texture);
+                    return std::nullopt;
+                }
+            }
+        }
+
+        cooked_model.Textures.resize(header.TextureCount);
+        for (Render::CookedTexture &texture : cooked_model.Textures) {
+            uint64_t embedded_size = 0;
+            if (!reader.readString(texture.Path) ||
+                !reader.readString(texture.Extension) ||
+                !reader.read(embedded_size) ||
+                !reader.readBytes(embedded_size, texture.EmbeddedData)) {
+                DIGNIS_LOG_ENGINE_WARN("The cooked model is truncated");
+                return std::nullopt;
+            }
+        }
+
+        for (const Render::Mesh &mesh : cooked_model.Meshes) {
+            if (mesh.Material.ID >= header.MaterialCount) {
+                DIGNIS_LOG_ENGINE_WARN("The cooked model references a missing material: {}", mesh.Material.ID);
+                return std::nullopt;
+            }
+        }
+
+        return cooked_model;
+    }
+
+    // Sources only found in a mounted pak have neither, they are recorded as zero.
+    uint64_t GetSourceSize(const std::filesystem::path &path) {
+        std::error_code error{};
+
+        const uint64_t size = std::filesystem::file_size(path, error);
+        return error ? 0 : size;
+    }
+
+    int64_t GetSourceWriteTime(const std::filesystem::path &path) {
+        std::error_code error{};
+
+        const std::filesystem::file_time_type write_time = std::filesystem::last_write_time(path, error);
+        return error ? 0 : static_cast<int64_t>(write_time.time_since_epoch().count());
+    }
+
+    int32_t GetSMikkTSpaceNumFaces(const SMikkTSpaceContext *context) {
+        return static_cast<int32_t>(static_cast<const SMikkTSpaceMesh *>(context->m_pUserData)->IndexCount) / 3;
+    }
+
+    int32_t GetSMikkTSpaceNumVerticesPerFace(const SMikkTSpaceContext *, const int32_t) {
+        return 3;
+    }
+
+    void GetSMikkTSpacePosition(const SMikkTSpaceContext *context, glm::f32 o_fv_position[3], const int32_t i_face, const int32_t i_vertex) {
+        const auto *mesh     = static_cast<const SMikkTSpaceMesh *>(context->m_pUserData);
+        const auto &index    = mesh->Indices[i_face * 3 + i_vertex];
+        const auto &vertex   = mesh->Vertices[index];
+        const auto &position = vertex.Position;
+
+        o_fv_position[0] = position.x;
+        o_fv_position[1] = position.y;
+        o_fv_position[2] = position.z;
+    }
+
+    void GetSMikkTSpaceNormal(const SMikkTSpaceContext *context, glm::f32 o_fv_normal[3], const int32_t i_face, const int32_t i_vertex) {
+        const auto *mesh   = static_cast<const SMikkTSpaceMesh *>(context->m_pUserData);
+        const auto &index  = mesh->Indices[i_face * 3 + i_vertex];
+        const auto &vertex = mesh->Vertices[index];
+        const auto &normal = vertex.Normal;
+
+        o_fv_normal[0] = normal.x;
+        o_fv_normal[1] = normal.y;
+        o_fv_normal[2] = normal.z;
+    }
+
+    void GetSMikkTSpaceUV(const SMikkTSpaceContext *context, glm::f32 o_fv_uv[2], const int32_t i_face, const int32_t i_vertex) {
+        const auto *mesh   = static_cast<const SMikkTSpaceMesh *>(context->m_pUserData);
+        const auto &index  = mesh->Indices[i_face * 3 + i_vertex];
+        const auto &vertex = mesh->Vertices[index];
+        const auto &uv     = vertex.UV;
+
+        o_fv_uv[0] = uv.x;
+        o_fv_uv[1] = uv.y;
+    }
+
+    void SetSMikkTSpaceBasic(const SMikkTSpaceContext *context, const glm::f32 fv_tangent[3], const glm::f32 f_sign, const int32_t i_face, const int32_t i_vertex) {
+        const auto *mesh  = static_cast<SMikkTSpaceMesh *>(context->m_pUserData);
+        const auto &index = mesh->Indices[i_face * 3 + i_vertex];
+
+        auto &vertex  = mesh->Vertices[index];
+        auto &tangent = vertex.Tangent;
+
+        tangent.x = fv_tangent[0];
+        tangent.y = fv_tangent[1];
+        tangent.z = fv_tangent[2];
+        tangent.w = f_sign;
+    }
+}  // namespace Ignis
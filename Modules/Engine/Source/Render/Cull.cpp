@@ -0,0 +1,528 @@
+#include <Ignis/Render.hpp>
+
+namespace Ignis {
+    constexpr uint32_t k_CullGroupSize         = 64;
+    constexpr uint32_t k_CullGroupRowSize      = 2048;
+    constexpr uint32_t k_CullChunkSize         = 1024;
+    constexpr uint32_t k_DepthPyramidGroupSize = 8;
+
+    void ExtractFrustumPlanes(const glm::mat4x4 &projection_view, glm::vec4 (&planes)[6]);
+
+    void Render::initializeCulling(const Settings &settings) {
+        m_CullingMode = settings.Culling;
+
+        m_CullChunks.clear();
+        m_CulledInstances.clear();
+        m_CulledDrawCommands.clear();
+
+        m_OcclusionCulling = settings.OcclusionCulling;
+
+        m_FrameGraphDepthPyramid = FrameGraph::k_InvalidImageID;
+
+        if (CullingMode::eGPU != m_CullingMode)
+            return;
+
+        m_DepthPyramidDescriptorLayout =
+            Vulkan::DescriptorSetLayoutBuilder()
+                .addCombinedImageSampler(vk::DescriptorBindingFlagBits::ePartiallyBound, 0, vk::ShaderStageFlagBits::eCompute)
+                .addCombinedImageSampler(vk::DescriptorBindingFlagBits::ePartiallyBound, 1, vk::ShaderStageFlagBits::eCompute)
+                .addStorageImage(
+                    vk::DescriptorBindingFlagBits::ePartiallyBound,
+                    2, k_MaxDepthPyramidMipCount, vk::ShaderStageFlagBits::eCompute)
+                .build();
+
+        m_DepthPyramidDescriptorSet = Vulkan::AllocateDescriptorSet(m_DepthPyramidDescriptorLayout, m_DescriptorPool);
+
+        const FileAsset cull_shader_file = FileAsset::LoadBinaryFromPath("Assets/Shaders/Ignis/Cull.spv").value();
+
+        std::vector<uint32_t> cull_shader_code{};
+        cull_shader_code.resize(cull_shader_file.getSize() * sizeof(char) / sizeof(uint32_t));
+
+        std::memcpy(cull_shader_code.data(), cull_shader_file.getContent().data(), cull_shader_file.getSize());
+
+        const vk::ShaderModule cull_shader = Vulkan::CreateShaderModuleFromSPV(cull_shader_code);
+
+        m_CullPipelineLayout = Vulkan::CreatePipelineLayout(
+            vk::PushConstantRange{vk::ShaderStageFlagBits::eCompute, 0, sizeof(CullPC)},
+            {m_MaterialDescriptorLayout, m_LightDescriptorLayout, m_ModelDescriptorLayout, m_DepthPyramidDescriptorLayout});
+
+        m_CullResetPipeline = Vulkan::CreateComputePipeline({}, "cs_reset", cull_shader, m_CullPipelineLayout);
+        m_CullPipeline      = Vulkan::CreateComputePipeline({}, "cs_cull", cull_shader, m_CullPipelineLayout);
+
+        Vulkan::DestroyShaderModule(cull_shader);
+
+        const FileAsset depth_pyramid_shader_file = FileAsset::LoadBinaryFromPath("Assets/Shaders/Ignis/DepthPyramid.spv").value();
+
+        std::vector<uint32_t> depth_pyramid_shader_code{};
+        depth_pyramid_shader_code.resize(depth_pyramid_shader_file.getSize() * sizeof(char) / sizeof(uint32_t));
+
+        std::memcpy(depth_pyramid_shader_code.data(), depth_pyramid_shader_file.getContent().data(), depth_pyramid_shader_file.getSize());
+
+        const vk::ShaderModule depth_pyramid_shader = Vulkan::CreateShaderModuleFromSPV(depth_pyramid_shader_code);
+
+        m_DepthPyramidPipelineLayout = Vulkan::CreatePipelineLayout(
+            vk::PushConstantRange{vk::ShaderStageFlagBits::eCompute, 0, sizeof(DepthPyramidPC)},
+            {m_DepthPyramidDescriptorLayout});
+
+        m_DepthPyramidPipeline       = Vulkan::CreateComputePipeline({}, "cs_depth", depth_pyramid_shader, m_DepthPyramidPipelineLayout);
+        m_DepthPyramidReducePipeline = Vulkan::CreateComputePipeline({}, "cs_reduce", depth_pyramid_shader, m_DepthPyramidPipelineLayout);
+
+        Vulkan::DestroyShaderModule(depth_pyramid_shader);
+    }
+
+    void Render::releaseCulling() {
+        m_CullChunks.clear();
+        m_CulledInstances.clear();
+        m_CulledDrawCommands.clear();
+
+        if (CullingMode::eGPU != m_CullingMode)
+            return;
+
+        releaseDepthPyramid();
+
+        Vulkan::DestroyPipeline(m_DepthPyramidReducePipeline);
+        Vulkan::DestroyPipeline(m_DepthPyramidPipeline);
+        Vulkan::DestroyPipelineLayout(m_DepthPyramidPipelineLayout);
+
+        Vulkan::DestroyPipeline(m_CullPipeline);
+        Vulkan::DestroyPipeline(m_CullResetPipeline);
+        Vulkan::DestroyPipelineLayout(m_CullPipelineLayout);
+
+        Vulkan::DestroyDescriptorSetLayout(m_DepthPyramidDescriptorLayout);
+    }
+
+    void Render::setCullViewport(const FrameGraph::ImageID depth_image) {
+        if (CullingMode::eGPU != m_CullingMode || !m_OcclusionCulling)
+            return;
+
+        // The pyramid and its descriptors are replaced, so nothing in flight may still use them.
+        Vulkan::WaitDeviceIdle();
+
+        const vk::Extent3D depth_extent = m_pFrameGraph->getImageExtent(depth_image);
+
+        releaseDepthPyramid();
+        createDepthPyramid(vk::Extent2D{depth_extent.width, depth_extent.height});
+
+        Vulkan::DescriptorSetWriter()
+            .writeCombinedImageSampler(0, m_pFrameGraph->getImageView(depth_image), vk::ImageLayout::eDepthReadOnlyOptimal, m_Sampler)
+            .update(m_DepthPyramidDescriptorSet);
+    }
+
+    void Render::createDepthPyramid(const vk::Extent2D &depth_extent) {
+        // Mip 0 is half the depth resolution, rounded up, so every pyramid texel covers whole depth texels.
+        const vk::Extent2D extent{
+            glm::max((depth_extent.width + 1) / 2, 1u),
+            glm::max((depth_extent.height + 1) / 2, 1u),
+        };
+
+        const uint32_t mip_level_count = glm::min(
+            static_cast<uint32_t>(std::bit_width(glm::max(extent.width, extent.height))),
+            k_MaxDepthPyramidMipCount);
+
+        m_DepthPyramidImage = Vulkan::AllocateImage2D(
+            {}, vma::MemoryUsage::eGpuOnly, {},
+            vk::Format::eR32Sfloat,
+            vk::ImageUsageFlagBits::eStorage |
+                vk::ImageUsageFlagBits::eSampled,
+            mip_level_count,
+            extent);
+
+        m_DepthPyramidView = Vulkan::CreateImageColorView2DWithMipLevels(
+            m_DepthPyramidImage.Handle, m_DepthPyramidImage.Format,
+            0, mip_level_count);
+
+        Vulkan::DescriptorSetWriter writer{};
+        writer.writeCombinedImageSampler(1, m_DepthPyramidView, vk::ImageLayout::eShaderReadOnlyOptimal, m_Sampler);
+
+        m_DepthPyramidMipViews.clear();
+        for (uint32_t i = 0; i < mip_level_count; i++) {
+            m_DepthPyramidMipViews.push_back(Vulkan::CreateImageColorView2DWithMipLevels(
+                m_DepthPyramidImage.Handle, m_DepthPyramidImage.Format,
+                i, 1));
+
+            writer.writeStorageImage(2, i, m_DepthPyramidMipViews.back(), vk::ImageLayout::eGeneral);
+        }
+
+        writer.update(m_DepthPyramidDescriptorSet);
+
+        Vulkan::ImmediateSubmit([&](const vk::CommandBuffer command_buffer) {
+            Vulkan::BarrierMerger merger{};
+            merger.putImageBarrier(
+                m_DepthPyramidImage.Handle,
+                vk::ImageLayout::eUndefined,
+                vk::ImageLayout::eShaderReadOnlyOptimal,
+                vk::PipelineStageFlagBits2::eNone,
+                vk::AccessFlagBits2::eNone,
+                vk::PipelineStageFlagBits2::eComputeShader,
+                vk::AccessFlagBits2::eShaderSampledRead);
+            merger.flushBarriers(command_buffer);
+        });
+
+        m_FrameGraphDepthPyramid = m_pFrameGraph->importImage(
+            m_DepthPyramidImage.Handle,
+            m_DepthPyramidView,
+            m_DepthPyramidImage.Format,
+            m_DepthPyramidImage.Usage,
+            extent,
+            vk::ImageLayout::eShaderReadOnlyOptimal,
+            vk::ImageLayout::eShaderReadOnlyOptimal);
+    }
+
+    void Render::releaseDepthPyramid() {
+        if (FrameGraph::k_InvalidImageID == m_FrameGraphDepthPyramid)
+            return;
+
+        m_pFrameGraph->removeImage(m_FrameGraphDepthPyramid);
+
+        for (const vk::ImageView view : m_DepthPyramidMipViews)
+            Vulkan::DestroyImageView(view);
+
+        Vulkan::DestroyImageView(m_DepthPyramidView);
+        Vulkan::DestroyImage(m_DepthPyramidImage);
+
+        m_DepthPyramidMipViews.clear();
+        m_DepthPyramidView = nullptr;
+
+        m_FrameGraphDepthPyramid = FrameGraph::k_InvalidImageID;
+    }
+
+    void Render::cullInstances() {
+        const auto draw_count = static_cast<uint32_t>(m_DrawCommands.size());
+        if (0 == draw_count)
+            return;
+
+        glm::vec4 planes[6];
+        ExtractFrustumPlanes(m_Camera.Projection * m_Camera.View, planes);
+
+        m_CullChunks.clear();
+        for (const auto &[model_id, model] : m_Models) {
+            if (0 == model.MeshCount)
+                continue;
+
+            const uint32_t slot_base = m_DrawRecords[model.Draws[0]].InstanceBase;
+
+            for (uint32_t first = 0; first < model.InstanceCount; first += k_CullChunkSize)
+                m_CullChunks.push_back(CullChunk{model_id, first, glm::min(k_CullChunkSize, model.InstanceCount - first), slot_base, 0});
+        }
+
+        m_CulledInstances.resize(m_VisibleInstanceCapacity);
+
+        std::for_each(
+            std::execution::par,
+            std::begin(m_CullChunks), std::end(m_CullChunks),
+            [&](CullChunk &chunk) {
+                const Model &model = m_Models.at(chunk.Model);
+
+                const glm::vec4 bounding_sphere{model.BoundingSphere};
+
+                // Structure-of-arrays spheres keep the plane loops branch-free, so they vectorize.
+                std::array<glm::f32, k_CullChunkSize> xs;
+                std::array<glm::f32, k_CullChunkSize> ys;
+                std::array<glm::f32, k_CullChunkSize> zs;
+                std::array<glm::f32, k_CullChunkSize> rs;
+                std::array<uint8_t, k_CullChunkSize>  visible;
+
+                for (uint32_t i = 0; i < chunk.Count; i++) {
+                    const glm::mat4x4 &transform = model.Instances[chunk.First + i].VertexTransform;
+
+                    const glm::vec3 center = transform * glm::vec4{glm::vec3{bounding_sphere}, 1.0f};
+                    const glm::f32  scale  = glm::max(
+                        glm::length(glm::vec3{transform[0]}),
+                        glm::max(glm::length(glm::vec3{transform[1]}), glm::length(glm::vec3{transform[2]})));
+
+                    xs[i]      = center.x;
+                    ys[i]      = center.y;
+                    zs[i]      = center.z;
+                    rs[i]      = bounding_sphere.w * scale;
+                    visible[i] = 1;
+                }
+
+                for (const glm::vec4 &plane : planes) {
+                    for (uint32_t i = 0; i < chunk.Count; i++)
+                        visible[i] &= static_cast<uint8_t>(plane.x * xs[i] + plane.y * ys[i] + plane.z * zs[i] + plane.w >= -rs[i]);
+                }
+
+                // Survivors are packed at the chunk's own slots, compaction across chunks happens afterwards.
+                uint32_t *culled_instances = m_CulledInstances.data() + chunk.SlotBase + chunk.First;
+
+                uint32_t visible_count = 0;
+                for (uint32_t i = 0; i < chunk.Count; i++) {
+                    culled_instances[visible_count] = chunk.First + i;
+                    visible_count += visible[i];
+                }
+
+                chunk.VisibleCount = visible_count;
+            });
+
+        m_CulledDrawCommands = m_DrawCommands;
+        for (auto &culled_draw_command : m_CulledDrawCommands)
+            culled_draw_command.instanceCount = 0;
+
+        for (size_t i = 0; i < m_CullChunks.size();) {
+            const ModelID  model_id  = m_CullChunks[i].Model;
+            const uint32_t slot_base = m_CullChunks[i].SlotBase;
+
+            uint32_t visible_count = 0;
+            for (; i < m_CullChunks.size() && model_id == m_CullChunks[i].Model; i++) {
+                const CullChunk &chunk = m_CullChunks[i];
+
+                if (visible_count != chunk.First) {
+                    std::copy_n(
+                        m_CulledInstances.data() + slot_base + chunk.First,
+                        chunk.VisibleCount,
+                        m_CulledInstances.data() + slot_base + visible_count);
+                }
+
+                visible_count += chunk.VisibleCount;
+            }
+
+            const Model &model = m_Models.at(model_id);
+            for (uint32_t j = 0; j < model.MeshCount; j++)
+                m_CulledDrawCommands[model.Draws[j]].instanceCount = visible_count;
+
+            uploadToBuffer(
+                m_VisibleInstanceBuffer,
+                sizeof(uint32_t) * slot_base,
+                m_CulledInstances.data() + slot_base,
+                sizeof(uint32_t) * visible_count);
+        }
+
+        uploadToBuffer(
+            m_CulledDrawCommandBuffer, 0,
+            m_CulledDrawCommands.data(),
+            sizeof(vk::DrawIndexedIndirectCommand) * draw_count);
+    }
+
+    void Render::updateCullDrawOffsets() {
+        if (!m_CullDrawOffsetsDirty)
+            return;
+
+        const auto draw_count = static_cast<uint32_t>(m_DrawCommands.size());
+
+        m_CullDrawOffsets.resize(draw_count);
+
+        uint32_t instance_count = 0;
+        for (uint32_t draw = 0; draw < draw_count; draw++) {
+            m_CullDrawOffsets[draw] = instance_count;
+            instance_count += m_DrawCommands[draw].instanceCount;
+        }
+
+        m_CullInstanceCount = instance_count;
+
+        if (0 != draw_count)
+            uploadToBuffer(
+                m_CullDrawOffsetBuffer, 0,
+                m_CullDrawOffsets.data(),
+                sizeof(uint32_t) * draw_count);
+
+        m_CullDrawOffsetsDirty = false;
+    }
+
+    void Render::recordCulling(FrameGraph &frame_graph, const CullPhase phase) {
+        const auto draw_count = static_cast<uint32_t>(m_DrawCommands.size());
+
+        CullPC cull_pc{};
+        cull_pc.ProjectionView = m_Camera.Projection * m_Camera.View;
+        cull_pc.Phase          = static_cast<glm::u32>(phase);
+        cull_pc.DrawCount      = draw_count;
+        cull_pc.InstanceCount  = m_CullInstanceCount;
+
+        if (CullPhase::eLate == phase) {
+            const vk::Extent3D depth_extent = m_pFrameGraph->getImageExtent(m_DepthImage);
+
+            cull_pc.DepthSize            = glm::vec2{depth_extent.width, depth_extent.height};
+            cull_pc.DepthPyramidSize     = glm::vec2{m_DepthPyramidImage.Extent.width, m_DepthPyramidImage.Extent.height};
+            cull_pc.DepthPyramidMipCount = m_DepthPyramidImage.MipLevelCount;
+        }
+
+        const auto compute_info = [](FrameGraph::BufferInfo info) {
+            info.StageMask = vk::PipelineStageFlagBits2::eComputeShader;
+            return info;
+        };
+
+        FrameGraph::ComputePass cull_pass{
+            CullPhase::eLate == phase ? "Ignis::Render::Late Cull Pass" : "Ignis::Render::Cull Pass",
+            {0.0f, 1.0f, 0.0f, 1.0f},
+        };
+
+        cull_pass
+            .readBuffer(compute_info(m_FrameGraphDrawCommandBuffer))
+            .readBuffer(compute_info(m_FrameGraphDrawRecordBuffer))
+            .readBuffer(compute_info(m_FrameGraphCullDrawOffsetBuffer))
+            .writeBuffer(compute_info(m_FrameGraphCulledDrawCommandBuffer))
+            .writeBuffer(compute_info(m_FrameGraphVisibleInstanceBuffer))
+            .writeBuffer(m_FrameGraphInstanceVisibilityBuffer);
+
+        if (CullPhase::eLate == phase)
+            cull_pass.readImage(FrameGraph::ImageInfo{m_FrameGraphDepthPyramid, vk::PipelineStageFlagBits2::eComputeShader});
+
+        for (const FrameGraph::BufferInfo &info : m_FrameGraphModelMeshBuffers.getData())
+            cull_pass.readBuffer(compute_info(info));
+        for (const FrameGraph::BufferInfo &info : m_FrameGraphModelInstancePageTables.getData())
+            cull_pass.readBuffer(compute_info(info));
+        for (const FrameGraph::BufferInfo &info : m_InstancePages.FrameGraphPages)
+            cull_pass.readBuffer(compute_info(info));
+
+        cull_pass.setExecute(
+            [this,
+             cull_pc,
+             culled_draw_command_buffer = m_CulledDrawCommandBuffer.Handle,
+             visible_instance_buffer    = m_VisibleInstanceBuffer.Handle,
+             instance_visibility_buffer = m_InstanceVisibilityBuffer.Handle,
+             instance_group_count       = (m_CullInstanceCount + k_CullGroupSize - 1) / k_CullGroupSize](const vk::CommandBuffer command_buffer) {
+                if (0 == cull_pc.DrawCount)
+                    return;
+
+                // Earlier frames may still be drawing from the culled output.
+                Vulkan::BarrierMerger merger{};
+                merger.putBufferBarrier(
+                    culled_draw_command_buffer, 0, vk::WholeSize,
+                    vk::PipelineStageFlagBits2::eDrawIndirect,
+                    vk::AccessFlagBits2::eNone,
+                    vk::PipelineStageFlagBits2::eComputeShader,
+                    vk::AccessFlagBits2::eShaderStorageWrite);
+                merger.putBufferBarrier(
+                    visible_instance_buffer, 0, vk::WholeSize,
+                    vk::PipelineStageFlagBits2::eVertexShader,
+                    vk::AccessFlagBits2::eNone,
+                    vk::PipelineStageFlagBits2::eComputeShader,
+                    vk::AccessFlagBits2::eShaderStorageWrite);
+                merger.putBufferBarrier(
+                    instance_visibility_buffer, 0, vk::WholeSize,
+                    vk::PipelineStageFlagBits2::eComputeShader,
+                    vk::AccessFlagBits2::eShaderStorageWrite,
+                    vk::PipelineStageFlagBits2::eComputeShader,
+                    vk::AccessFlagBits2::eShaderStorageRead | vk::AccessFlagBits2::eShaderStorageWrite);
+                merger.flushBarriers(command_buffer);
+
+                command_buffer.bindDescriptorSets(
+                    vk::PipelineBindPoint::eCompute,
+                    m_CullPipelineLayout, 2,
+                    {m_ModelDescriptorSet, m_DepthPyramidDescriptorSet}, {});
+                command_buffer.pushConstants(
+                    m_CullPipelineLayout,
+                    vk::ShaderStageFlagBits::eCompute,
+                    0,
+                    sizeof(CullPC),
+                    &cull_pc);
+
+                command_buffer.bindPipeline(vk::PipelineBindPoint::eCompute, m_CullResetPipeline);
+                command_buffer.dispatch((cull_pc.DrawCount + k_CullGroupSize - 1) / k_CullGroupSize, 1, 1);
+
+                merger.putBufferBarrier(
+                    culled_draw_command_buffer, 0, vk::WholeSize,
+                    vk::PipelineStageFlagBits2::eComputeShader,
+                    vk::AccessFlagBits2::eShaderStorageWrite,
+                    vk::PipelineStageFlagBits2::eComputeShader,
+                    vk::AccessFlagBits2::eShaderStorageRead | vk::AccessFlagBits2::eShaderStorageWrite);
+                merger.flushBarriers(command_buffer);
+
+                if (0 == instance_group_count)
+                    return;
+
+                // One thread per instance across all draws, rows of 2048 workgroups cover any 32-bit instance count.
+                command_buffer.bindPipeline(vk::PipelineBindPoint::eCompute, m_CullPipeline);
+                command_buffer.dispatch(
+                    glm::min(instance_group_count, k_CullGroupRowSize),
+                    (instance_group_count + k_CullGroupRowSize - 1) / k_CullGroupRowSize,
+                    1);
+            });
+
+        frame_graph.addComputePass(cull_pass);
+    }
+
+    void Render::recordDepthPyramid(FrameGraph &frame_graph) {
+        FrameGraph::ComputePass depth_pyramid_pass{
+            "Ignis::Render::Depth Pyramid Pass",
+            {0.0f, 0.5f, 1.0f, 1.0f},
+        };
+
+        depth_pyramid_pass.writeImage(FrameGraph::ImageInfo{m_FrameGraphDepthPyramid, vk::PipelineStageFlagBits2::eComputeShader});
+
+        depth_pyramid_pass.setExecute(
+            [this,
+             depth_image   = m_pFrameGraph->getImage(m_DepthImage),
+             pyramid_image = m_DepthPyramidImage](const vk::CommandBuffer command_buffer) {
+                // The frame graph samples images as color, so the depth attachment is handed over here.
+                Vulkan::BarrierMerger merger{};
+                merger.putImageBarrier(
+                    depth_image,
+                    vk::ImageLayout::eDepthAttachmentOptimal,
+                    vk::ImageLayout::eDepthReadOnlyOptimal,
+                    vk::PipelineStageFlagBits2::eEarlyFragmentTests |
+                        vk::PipelineStageFlagBits2::eLateFragmentTests,
+                    vk::AccessFlagBits2::eDepthStencilAttachmentWrite,
+                    vk::PipelineStageFlagBits2::eComputeShader,
+                    vk::AccessFlagBits2::eShaderSampledRead);
+                merger.flushBarriers(command_buffer);
+
+                command_buffer.bindDescriptorSets(
+                    vk::PipelineBindPoint::eCompute,
+                    m_DepthPyramidPipelineLayout, 0,
+                    {m_DepthPyramidDescriptorSet}, {});
+
+                for (uint32_t level = 0; level < pyramid_image.MipLevelCount; level++) {
+                    const DepthPyramidPC depth_pyramid_pc{level};
+
+                    const uint32_t width  = glm::max(pyramid_image.Extent.width >> level, 1u);
+                    const uint32_t height = glm::max(pyramid_image.Extent.height >> level, 1u);
+
+                    command_buffer.bindPipeline(
+                        vk::PipelineBindPoint::eCompute,
+                        0 == level ? m_DepthPyramidPipeline : m_DepthPyramidReducePipeline);
+                    command_buffer.pushConstants(
+                        m_DepthPyramidPipelineLayout,
+                        vk::ShaderStageFlagBits::eCompute,
+                        0,
+                        sizeof(DepthPyramidPC),
+                        &depth_pyramid_pc);
+                    command_buffer.dispatch(
+                        (width + k_DepthPyramidGroupSize - 1) / k_DepthPyramidGroupSize,
+                        (height + k_DepthPyramidGroupSize - 1) / k_DepthPyramidGroupSize,
+                        1);
+
+                    merger.putImageBarrier(
+                        pyramid_image.Handle,
+                        vk::ImageLayout::eGeneral,
+                        vk::ImageLayout::eGeneral,
+                        level, 1, 0, 1,
+                        vk::PipelineStageFlagBits2::eComputeShader,
+                        vk::AccessFlagBits2::eShaderStorageWrite,
+                        vk::PipelineStageFlagBits2::eComputeShader,
+                        vk::AccessFlagBits2::eShaderStorageRead | vk::AccessFlagBits2::eShaderSampledRead);
+                    merger.flushBarriers(command_buffer);
+                }
+
+                merger.putImageBarrier(
+                    depth_image,
+                    vk::ImageLayout::eDepthReadOnlyOptimal,
+                    vk::ImageLayout::eDepthAttachmentOptimal,
+                    vk::PipelineStageFlagBits2::eComputeShader,
+                    vk::AccessFlagBits2::eShaderSampledRead,
+                    vk::PipelineStageFlagBits2::eEarlyFragmentTests |
+                        vk::PipelineStageFlagBits2::eLateFragmentTests,
+                    vk::AccessFlagBits2::eDepthStencilAttachmentRead |
+                        vk::AccessFlagBits2::eDepthStencilAttachmentWrite);
+                merger.flushBarriers(command_buffer);
+            });
+
+        frame_graph.addComputePass(depth_pyramid_pass);
+    }
+
+    void ExtractFrustumPlanes(const glm::mat4x4 &projection_view, glm::vec4 (&planes)[6]) {
+        const glm::vec4 row0 = glm::row(projection_view, 0);
+        const glm::vec4 row1 = glm::row(projection_view, 1);
+        const glm::vec4 row2 = glm::row(projection_view, 2);
+        const glm::vec4 row3 = glm::row(projection_view, 3);
+
+        planes[0] = row3 + row0;
+        planes[1] = row3 - row0;
+        planes[2] = row3 + row1;
+        planes[3] = row3 - row1;
+        planes[4] = row2;
+        planes[5] = row3 - row2;
+
+        for (glm::vec4 &plane : planes)
+            plane /= glm::length(glm::vec3{plane});
+    }
+}  // namespace Ignis
@@ -48,10 +48,10 @@ namespace Ignis {
         m_LoadedTextures.emplace("[Ignis::Render::Normal Texture]", m_NormalTexture);
         m_LoadedTextures.emplace("[Ignis::Render::MetallicRoughness Texture]", m_MetallicRoughnessTexture);
 
-        m_LoadedTexturePaths.emplace(m_BlackTexture, "[Ignis::Render::Black Texture]");
-        m_LoadedTexturePaths.emplace(m_WhiteTexture, "[Ignis::Render::White Texture]");
-        m_LoadedTexturePaths.emplace(m_NormalTexture, "[Ignis::Render::Normal Texture]");
-        m_LoadedTexturePaths.emplace(m_MetallicRoughnessTexture, "[Ignis::Render::MetallicRoughness Texture]");
+        m_LoadedTextureKeys.emplace(m_BlackTexture, "[Ignis::Render::Black Texture]");
+        m_LoadedTextureKeys.emplace(m_WhiteTexture, "[Ignis::Render::White Texture]");
+        m_LoadedTextureKeys.emplace(m_NormalTexture, "[Ignis::Render::Normal Texture]");
+        m_LoadedTextureKeys.emplace(m_MetallicRoughnessTexture, "[Ignis::Render::MetallicRoughness Texture]");
 
         const glm::uint32 colors[4]{
             glm::packUnorm4x8({0.0f, 0.0f, 0.0f, 1.0f}),
@@ -0,0 +1,404 @@
+#include <Ignis/Render.hpp>
+
+namespace Ignis {
+    void RadixSortDrawKeys(std::vector<uint64_t> &keys, std::vector<uint64_t> &scratch);
+
+    double Render::GetDrawSortTime() {
+        DIGNIS_ASSERT(nullptr != s_pInstance, "Ignis::Render is not initialized.");
+        return s_pInstance->getDrawSortTime();
+    }
+
+    void Render::initializeDraws(const Settings &settings) {
+        m_DrawCommands.clear();
+        m_DrawRecords.clear();
+
+        m_DrawCountBuffer = allocateUploadBuffer(
+            m_InstanceUploadStrategy,
+            sizeof(uint32_t),
+            vk::BufferUsageFlagBits::eIndirectBuffer |
+                vk::BufferUsageFlagBits::eStorageBuffer);
+
+        m_FrameGraphDrawCountBuffer = FrameGraph::BufferInfo{
+            m_pFrameGraph->importBuffer(m_DrawCountBuffer.Handle, m_DrawCountBuffer.Usage, 0, m_DrawCountBuffer.Size),
+            0,
+            m_DrawCountBuffer.Size,
+            vk::PipelineStageFlagBits2::eDrawIndirect,
+        };
+
+        constexpr uint32_t draw_count = 0;
+        uploadToBuffer(m_DrawCountBuffer, 0, &draw_count, sizeof(uint32_t));
+
+        allocateDrawBuffers(settings.InitialDrawCapacity);
+        allocateVisibleInstanceBuffer(k_InstancesPerPage);
+
+        m_CullDrawOffsets.clear();
+
+        m_CullInstanceCount    = 0;
+        m_CullDrawOffsetsDirty = false;
+    }
+
+    void Render::releaseDraws() {
+        releaseDrawBuffers();
+        releaseVisibleInstanceBuffer();
+
+        m_pFrameGraph->removeBuffer(m_FrameGraphDrawCountBuffer.Buffer);
+
+        discardUploads(m_DrawCountBuffer.Handle);
+        Vulkan::DestroyBuffer(m_DrawCountBuffer);
+
+        m_FrameGraphDrawCountBuffer.Buffer = FrameGraph::k_InvalidBufferID;
+
+        m_DrawCommands.clear();
+        m_DrawRecords.clear();
+        m_MaterialDrawRanges.clear();
+
+        m_DrawKeyBases.clear();
+        m_DrawSlots.clear();
+
+        m_CullDrawOffsets.clear();
+    }
+
+    void Render::allocateDrawBuffers(const uint32_t draw_capacity) {
+        m_DrawCapacity = draw_capacity;
+
+        m_DrawCommandBuffer = allocateUploadBuffer(
+            m_InstanceUploadStrategy,
+            sizeof(vk::DrawIndexedIndirectCommand) * draw_capacity,
+            vk::BufferUsageFlagBits::eIndirectBuffer |
+                vk::BufferUsageFlagBits::eStorageBuffer);
+
+        m_DrawRecordBuffer = allocateUploadBuffer(
+            m_InstanceUploadStrategy,
+            sizeof(DrawRecord) * draw_capacity,
+            vk::BufferUsageFlagBits::eStorageBuffer);
+
+        m_CullDrawOffsetBuffer = allocateUploadBuffer(
+            m_InstanceUploadStrategy,
+            sizeof(uint32_t) * draw_capacity,
+            vk::BufferUsageFlagBits::eStorageBuffer);
+
+        m_CulledDrawCommandBuffer = Vulkan::AllocateBuffer(
+            {}, vma::MemoryUsage::eGpuOnly, {},
+            sizeof(vk::DrawIndexedIndirectCommand) * draw_capacity,
+            vk::BufferUsageFlagBits::eIndirectBuffer |
+                vk::BufferUsageFlagBits::eStorageBuffer |
+                vk::BufferUsageFlagBits::eTransferDst);
+
+        m_FrameGraphDrawCommandBuffer = FrameGraph::BufferInfo{
+            m_pFrameGraph->importBuffer(m_DrawCommandBuffer.Handle, m_DrawCommandBuffer.Usage, 0, m_DrawCommandBuffer.Size),
+            0,
+            m_DrawCommandBuffer.Size,
+            vk::PipelineStageFlagBits2::eComputeShader,
+        };
+
+        m_FrameGraphDrawRecordBuffer = FrameGraph::BufferInfo{
+            m_pFrameGraph->importBuffer(m_DrawRecordBuffer.Handle, m_DrawRecordBuffer.Usage, 0, m_DrawRecordBuffer.Size),
+            0,
+            m_DrawRecordBuffer.Size,
+            vk::PipelineStageFlagBits2::eVertexShader,
+        };
+
+        m_FrameGraphCullDrawOffsetBuffer = FrameGraph::BufferInfo{
+            m_pFrameGraph->importBuffer(m_CullDrawOffsetBuffer.Handle, m_CullDrawOffsetBuffer.Usage, 0, m_CullDrawOffsetBuffer.Size),
+            0,
+            m_CullDrawOffsetBuffer.Size,
+            vk::PipelineStageFlagBits2::eComputeShader,
+        };
+
+        m_FrameGraphCulledDrawCommandBuffer = FrameGraph::BufferInfo{
+            m_pFrameGraph->importBuffer(m_CulledDrawCommandBuffer.Handle, m_CulledDrawCommandBuffer.Usage, 0, m_CulledDrawCommandBuffer.Size),
+            0,
+            m_CulledDrawCommandBuffer.Size,
+            vk::PipelineStageFlagBits2::eDrawIndirect,
+        };
+
+        Vulkan::DescriptorSetWriter()
+            .writeStorageBuffer(3, m_DrawRecordBuffer.Handle, 0, m_DrawRecordBuffer.Size)
+            .writeStorageBuffer(4, m_DrawCommandBuffer.Handle, 0, m_DrawCommandBuffer.Size)
+            .writeStorageBuffer(5, m_CulledDrawCommandBuffer.Handle, 0, m_CulledDrawCommandBuffer.Size)
+            .writeStorageBuffer(8, m_CullDrawOffsetBuffer.Handle, 0, m_CullDrawOffsetBuffer.Size)
+            .update(m_ModelDescriptorSet);
+    }
+
+    void Render::releaseDrawBuffers() {
+        m_pFrameGraph->removeBuffer(m_FrameGraphDrawCommandBuffer.Buffer);
+        m_pFrameGraph->removeBuffer(m_FrameGraphDrawRecordBuffer.Buffer);
+        m_pFrameGraph->removeBuffer(m_FrameGraphCullDrawOffsetBuffer.Buffer);
+        m_pFrameGraph->removeBuffer(m_FrameGraphCulledDrawCommandBuffer.Buffer);
+
+        discardUploads(m_DrawCommandBuffer.Handle);
+        discardUploads(m_DrawRecordBuffer.Handle);
+        discardUploads(m_CullDrawOffsetBuffer.Handle);
+        discardUploads(m_CulledDrawCommandBuffer.Handle);
+
+        Vulkan::DestroyBuffer(m_DrawCommandBuffer);
+        Vulkan::DestroyBuffer(m_DrawRecordBuffer);
+        Vulkan::DestroyBuffer(m_CullDrawOffsetBuffer);
+        Vulkan::DestroyBuffer(m_CulledDrawCommandBuffer);
+
+        m_FrameGraphDrawCommandBuffer.Buffer       = FrameGraph::k_InvalidBufferID;
+        m_FrameGraphDrawRecordBuffer.Buffer        = FrameGraph::k_InvalidBufferID;
+        m_FrameGraphCullDrawOffsetBuffer.Buffer    = FrameGraph::k_InvalidBufferID;
+        m_FrameGraphCulledDrawCommandBuffer.Buffer = FrameGraph::k_InvalidBufferID;
+
+        m_DrawCapacity = 0;
+    }
+
+    void Render::allocateVisibleInstanceBuffer(const uint32_t instance_capacity) {
+        m_VisibleInstanceCapacity = instance_capacity;
+
+        m_VisibleInstanceBuffer = Vulkan::AllocateBuffer(
+            {}, vma::MemoryUsage::eGpuOnly, {},
+            sizeof(uint32_t) * instance_capacity,
+            vk::BufferUsageFlagBits::eStorageBuffer |
+                vk::BufferUsageFlagBits::eTransferDst);
+
+        m_FrameGraphVisibleInstanceBuffer = FrameGraph::BufferInfo{
+            m_pFrameGraph->importBuffer(m_VisibleInstanceBuffer.Handle, m_VisibleInstanceBuffer.Usage, 0, m_VisibleInstanceBuffer.Size),
+            0,
+            m_VisibleInstanceBuffer.Size,
+            vk::PipelineStageFlagBits2::eVertexShader,
+        };
+
+        // Occlusion culling keeps one visibility bit per slot from the previous frame.
+        m_InstanceVisibilityBuffer = Vulkan::AllocateBuffer(
+            {}, vma::MemoryUsage::eGpuOnly, {},
+            sizeof(uint32_t) * instance_capacity,
+            vk::BufferUsageFlagBits::eStorageBuffer |
+                vk::BufferUsageFlagBits::eTransferDst);
+
+        Vulkan::ImmediateSubmit([&](const vk::CommandBuffer command_buffer) {
+            command_buffer.fillBuffer(m_InstanceVisibilityBuffer.Handle, 0, vk::WholeSize, 0);
+        });
+
+        m_FrameGraphInstanceVisibilityBuffer = FrameGraph::BufferInfo{
+            m_pFrameGraph->importBuffer(m_InstanceVisibilityBuffer.Handle, m_InstanceVisibilityBuffer.Usage, 0, m_InstanceVisibilityBuffer.Size),
+            0,
+            m_InstanceVisibilityBuffer.Size,
+            vk::PipelineStageFlagBits2::eComputeShader,
+        };
+
+        Vulkan::DescriptorSetWriter()
+            .writeStorageBuffer(6, m_VisibleInstanceBuffer.Handle, 0, m_VisibleInstanceBuffer.Size)
+            .writeStorageBuffer(7, m_InstanceVisibilityBuffer.Handle, 0, m_InstanceVisibilityBuffer.Size)
+            .update(m_ModelDescriptorSet);
+    }
+
+    void Render::releaseVisibleInstanceBuffer() {
+        m_pFrameGraph->removeBuffer(m_FrameGraphVisibleInstanceBuffer.Buffer);
+        m_pFrameGraph->removeBuffer(m_FrameGraphInstanceVisibilityBuffer.Buffer);
+
+        discardUploads(m_VisibleInstanceBuffer.Handle);
+        Vulkan::DestroyBuffer(m_VisibleInstanceBuffer);
+        Vulkan::DestroyBuffer(m_InstanceVisibilityBuffer);
+
+        m_FrameGraphVisibleInstanceBuffer.Buffer    = FrameGraph::k_InvalidBufferID;
+        m_FrameGraphInstanceVisibilityBuffer.Buffer = FrameGraph::k_InvalidBufferID;
+
+        m_VisibleInstanceCapacity = 0;
+    }
+
+    void Render::rebuildDraws() {
+        m_DrawCommands.clear();
+        m_DrawRecords.clear();
+        m_DrawKeyBases.clear();
+
+        // Every draw reserves a slot per instance its model has pages for, culling compacts into those slots.
+        // CPU culling tests whole model instances, so the meshes of a model share one slot range.
+        uint32_t instance_slot_count = 0;
+
+        for (auto &[model_id, model] : m_Models) {
+            const auto model_slot_count = static_cast<uint32_t>(model.InstancePages.size() * k_InstancesPerPage);
+
+            model.Draws.resize(model.MeshCount);
+
+            for (uint32_t i = 0; i < model.MeshCount; i++) {
+                const MaterialID material_id = model.Meshes[i].Material;
+                const auto       features    = m_MaterialFeatures.find(material_id);
+
+                const uint64_t material_features = m_MaterialFeatures.end() != features ? features->second : k_MaterialFeatureAll;
+
+                model.Draws[i] = static_cast<uint32_t>(m_DrawCommands.size());
+
+                m_DrawCommands.push_back(model.IndirectCommands[i]);
+                m_DrawRecords.push_back(DrawRecord{model_id, i, instance_slot_count});
+                m_DrawKeyBases.push_back(
+                    (material_features << k_DrawSortFeatureShift) |
+                    (static_cast<uint64_t>(material_id.ID & ((1u << k_DrawSortMaterialBits) - 1)) << k_DrawSortMaterialShift));
+
+                if (CullingMode::eGPU == m_CullingMode)
+                    instance_slot_count += model_slot_count;
+            }
+
+            if (CullingMode::eCPU == m_CullingMode)
+                instance_slot_count += model_slot_count;
+        }
+
+        const auto draw_count = static_cast<uint32_t>(m_DrawCommands.size());
+        DIGNIS_ASSERT(draw_count <= k_MaxDrawCount, "Draw count exceeds the draw sort key index bits.");
+
+        m_DrawSlots.resize(draw_count);
+        std::iota(std::begin(m_DrawSlots), std::end(m_DrawSlots), 0u);
+
+        if (draw_count > m_DrawCapacity || instance_slot_count > m_VisibleInstanceCapacity) {
+            // Model and instance page changes are rare, so the draw list can be swapped out in place.
+            Vulkan::WaitDeviceIdle();
+
+            if (draw_count > m_DrawCapacity) {
+                releaseDrawBuffers();
+                allocateDrawBuffers(std::bit_ceil(draw_count));
+            }
+            if (instance_slot_count > m_VisibleInstanceCapacity) {
+                releaseVisibleInstanceBuffer();
+                allocateVisibleInstanceBuffer(std::bit_ceil(instance_slot_count));
+            }
+        }
+
+        uploadToBuffer(m_DrawCountBuffer, 0, &draw_count, sizeof(uint32_t));
+
+        // The draw buffers still hold the previous layout, the sort uploads the new one.
+        m_DrawOrderDirty = true;
+        sortDraws();
+
+        createModelPipelines();
+    }
+
+    void Render::sortDraws() {
+        m_DrawSortTimer.start();
+
+        const auto draw_count = static_cast<uint32_t>(m_DrawKeyBases.size());
+
+        m_DrawSortKeys.resize(draw_count);
+
+        // Models are walked in the same order rebuildDraws laid their draws out in.
+        uint32_t draw = 0;
+        for (const Model &model : std::views::values(m_Models)) {
+            // An instanced draw is placed by its first instance, per-instance depth cannot reorder it.
+            const glm::mat4x4 transform =
+                0 != model.InstanceCount
+                    ? m_Camera.View * model.Instances[0].VertexTransform
+                    : m_Camera.View;
+
+            for (uint32_t i = 0; i < model.MeshCount; i++, draw++) {
+                // Spheres are in mesh space, the node transform places them in the model as the cull shader does.
+                const Mesh     &mesh   = model.Meshes[i];
+                const glm::vec4 center = transform * mesh.VertexTransform * glm::vec4{glm::vec3{mesh.BoundingSphere}, 1.0f};
+
+                // Non-negative floats order like their bits, the top 20 bits below the sign are kept.
+                const glm::f32 depth = glm::max(-center.z, 0.0f);
+
+                m_DrawSortKeys[draw] =
+                    m_DrawKeyBases[draw] |
+                    (static_cast<uint64_t>(std::bit_cast<uint32_t>(depth) >> 11) << k_DrawSortDepthShift) |
+                    draw;
+            }
+        }
+
+        RadixSortDrawKeys(m_DrawSortKeys, m_DrawSortScratch);
+
+        bool order_changed = m_DrawOrderDirty;
+        for (uint32_t slot = 0; slot < draw_count && !order_changed; slot++)
+            order_changed = slot != m_DrawSlots[m_DrawSortKeys[slot] & (k_MaxDrawCount - 1)];
+
+        if (order_changed) {
+            m_SortedDrawCommands.resize(draw_count);
+            m_SortedDrawRecords.resize(draw_count);
+
+            for (uint32_t slot = 0; slot < draw_count; slot++) {
+                const uint32_t previous_slot = m_DrawSlots[m_DrawSortKeys[slot] & (k_MaxDrawCount - 1)];
+
+                m_SortedDrawCommands[slot] = m_DrawCommands[previous_slot];
+                m_SortedDrawRecords[slot]  = m_DrawRecords[previous_slot];
+            }
+
+            std::swap(m_DrawCommands, m_SortedDrawCommands);
+            std::swap(m_DrawRecords, m_SortedDrawRecords);
+
+            m_MaterialDrawRanges.clear();
+            for (uint32_t slot = 0; slot < draw_count; slot++) {
+                const uint64_t key      = m_DrawSortKeys[slot];
+                const auto     features = static_cast<uint32_t>(key >> k_DrawSortFeatureShift);
+
+                m_DrawSlots[key & (k_MaxDrawCount - 1)] = slot;
+
+                if (m_MaterialDrawRanges.empty() || features != m_MaterialDrawRanges.back().Features)
+                    m_MaterialDrawRanges.push_back(MaterialDrawRange{features, slot, 0});
+
+                m_MaterialDrawRanges.back().DrawCount++;
+            }
+
+            draw = 0;
+            for (Model &model : std::views::values(m_Models)) {
+                for (uint32_t i = 0; i < model.MeshCount; i++, draw++)
+                    model.Draws[i] = m_DrawSlots[draw];
+            }
+
+            uploadToBuffer(
+                m_DrawCommandBuffer, 0,
+                m_DrawCommands.data(),
+                sizeof(vk::DrawIndexedIndirectCommand) * draw_count);
+            uploadToBuffer(
+                m_DrawRecordBuffer, 0,
+                m_DrawRecords.data(),
+                sizeof(DrawRecord) * draw_count);
+
+            m_DrawOrderDirty       = false;
+            m_CullDrawOffsetsDirty = true;
+        }
+
+        m_DrawSortTimer.stop();
+        m_DrawSortTime = m_DrawSortTimer.getElapsedTime();
+    }
+
+    double Render::getDrawSortTime() const {
+        return m_DrawSortTime;
+    }
+
+    void Render::readDrawBuffers(FrameGraph::RenderPass &render_pass) const {
+        render_pass.readBuffers({
+            m_FrameGraphCulledDrawCommandBuffer,
+            m_FrameGraphDrawRecordBuffer,
+            m_FrameGraphDrawCountBuffer,
+            m_FrameGraphVisibleInstanceBuffer,
+        });
+    }
+
+    void RadixSortDrawKeys(std::vector<uint64_t> &keys, std::vector<uint64_t> &scratch) {
+        constexpr uint32_t digit_bits  = 11;
+        constexpr uint32_t digit_count = 1u << digit_bits;
+        constexpr uint32_t pass_count  = (64 - Render::k_DrawSortIndexBits) / digit_bits;
+
+        static_assert(Render::k_DrawSortIndexBits + pass_count * digit_bits == 64);
+
+        if (keys.size() < 2)
+            return;
+
+        // The keys are built in draw order, so the index bits are already sorted and need no pass of their own.
+        std::array<std::array<uint32_t, digit_count>, pass_count> histograms{};
+        for (const uint64_t key : keys) {
+            for (uint32_t pass = 0; pass < pass_count; pass++)
+                histograms[pass][(key >> (Render::k_DrawSortIndexBits + pass * digit_bits)) & (digit_count - 1)]++;
+        }
+
+        scratch.resize(keys.size());
+
+        for (uint32_t pass = 0; pass < pass_count; pass++) {
+            const uint32_t shift = Render::k_DrawSortIndexBits + pass * digit_bits;
+
+            auto &histogram = histograms[pass];
+
+            // A digit every key shares leaves the order as it is, typically the feature and material bits.
+            if (keys.size() == histogram[(keys[0] >> shift) & (digit_count - 1)])
+                continue;
+
+            uint32_t offset = 0;
+            for (uint32_t &count : histogram)
+                offset += std::exchange(count, offset);
+
+            for (const uint64_t key : keys)
+                scratch[histogram[(key >> shift) & (digit_count - 1)]++] = key;
+
+            std::swap(keys, scratch);
+        }
+    }
+}  // namespace Ignis
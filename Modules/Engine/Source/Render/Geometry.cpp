@@ -0,0 +1,217 @@
+#include <Ignis/Render.hpp>
+
+namespace Ignis {
+    std::optional<Render::GeometryAllocation> AllocateGeometryRange(vma::VirtualBlock virtual_block, uint32_t count);
+
+    void Render::initializeGeometry(const Settings &settings) {
+        m_VertexBuffer = Vulkan::AllocateBuffer(
+            {}, vma::MemoryUsage::eGpuOnly, {},
+            sizeof(Vertex) * settings.InitialVertexCapacity,
+            vk::BufferUsageFlagBits::eVertexBuffer |
+                vk::BufferUsageFlagBits::eTransferSrc |
+                vk::BufferUsageFlagBits::eTransferDst);
+
+        m_IndexBuffer = Vulkan::AllocateBuffer(
+            {}, vma::MemoryUsage::eGpuOnly, {},
+            sizeof(uint32_t) * settings.InitialIndexCapacity,
+            vk::BufferUsageFlagBits::eIndexBuffer |
+                vk::BufferUsageFlagBits::eTransferSrc |
+                vk::BufferUsageFlagBits::eTransferDst);
+
+        m_VertexBlock = Vulkan::CreateVirtualBlock(settings.InitialVertexCapacity);
+        m_IndexBlock  = Vulkan::CreateVirtualBlock(settings.InitialIndexCapacity);
+
+        m_FrameGraphVertexBuffer = FrameGraph::BufferInfo{
+            m_pFrameGraph->importBuffer(m_VertexBuffer.Handle, m_VertexBuffer.Usage, 0, m_VertexBuffer.Size),
+            0,
+            m_VertexBuffer.Size,
+            vk::PipelineStageFlagBits2::eVertexInput,
+        };
+
+        m_FrameGraphIndexBuffer = FrameGraph::BufferInfo{
+            m_pFrameGraph->importBuffer(m_IndexBuffer.Handle, m_IndexBuffer.Usage, 0, m_IndexBuffer.Size),
+            0,
+            m_IndexBuffer.Size,
+            vk::PipelineStageFlagBits2::eIndexInput,
+        };
+    }
+
+    void Render::releaseGeometry() {
+        m_pFrameGraph->removeBuffer(m_FrameGraphVertexBuffer.Buffer);
+        m_pFrameGraph->removeBuffer(m_FrameGraphIndexBuffer.Buffer);
+
+        Vulkan::DestroyVirtualBlock(m_VertexBlock);
+        Vulkan::DestroyVirtualBlock(m_IndexBlock);
+
+        Vulkan::DestroyBuffer(m_VertexBuffer);
+        Vulkan::DestroyBuffer(m_IndexBuffer);
+
+        m_VertexBlock = nullptr;
+        m_IndexBlock  = nullptr;
+
+        m_FrameGraphVertexBuffer.Buffer = FrameGraph::k_InvalidBufferID;
+        m_FrameGraphIndexBuffer.Buffer  = FrameGraph::k_InvalidBufferID;
+    }
+
+    void Render::allocateGeometry(Model &model, const uint32_t vertex_count, const uint32_t index_count) {
+        std::optional<GeometryAllocation> vertex_allocation = AllocateGeometryRange(m_VertexBlock, vertex_count);
+        std::optional<GeometryAllocation> index_allocation  = AllocateGeometryRange(m_IndexBlock, index_count);
+
+        if (!vertex_allocation.has_value() || !index_allocation.has_value()) {
+            if (vertex_allocation.has_value())
+                m_VertexBlock.virtualFree(vertex_allocation->Allocation);
+            if (index_allocation.has_value())
+                m_IndexBlock.virtualFree(index_allocation->Allocation);
+
+            uint32_t used_vertex_count = vertex_count;
+            uint32_t used_index_count  = index_count;
+            for (const Model &loaded_model : std::views::values(m_Models)) {
+                used_vertex_count += loaded_model.VertexAllocation.Count;
+                used_index_count += loaded_model.IndexAllocation.Count;
+            }
+
+            const auto vertex_capacity = static_cast<uint32_t>(m_VertexBuffer.Size / sizeof(Vertex));
+            const auto index_capacity  = static_cast<uint32_t>(m_IndexBuffer.Size / sizeof(uint32_t));
+
+            // Compaction packs every live range at the front, so the new range always fits afterwards.
+            compactGeometry(
+                glm::max(vertex_capacity, std::bit_ceil(used_vertex_count)),
+                glm::max(index_capacity, std::bit_ceil(used_index_count)));
+
+            vertex_allocation = AllocateGeometryRange(m_VertexBlock, vertex_count);
+            index_allocation  = AllocateGeometryRange(m_IndexBlock, index_count);
+        }
+
+        DIGNIS_ASSERT(vertex_allocation.has_value() && index_allocation.has_value());
+
+        model.VertexAllocation = vertex_allocation.value();
+        model.IndexAllocation  = index_allocation.value();
+    }
+
+    void Render::freeGeometry(const GeometryAllocation &vertex_allocation, const GeometryAllocation &index_allocation) {
+        m_VertexBlock.virtualFree(vertex_allocation.Allocation);
+        m_IndexBlock.virtualFree(index_allocation.Allocation);
+
+        if (m_Models.empty())
+            return;
+
+        const vma::DetailedStatistics vertex_statistics = m_VertexBlock.calculateVirtualBlockStatistics();
+        const vma::DetailedStatistics index_statistics  = m_IndexBlock.calculateVirtualBlockStatistics();
+
+        // A single unused range is the tail of the block, anything more is a hole left by an unload.
+        if (vertex_statistics.unusedRangeCount > 1 || index_statistics.unusedRangeCount > 1) {
+            compactGeometry(
+                static_cast<uint32_t>(m_VertexBuffer.Size / sizeof(Vertex)),
+                static_cast<uint32_t>(m_IndexBuffer.Size / sizeof(uint32_t)));
+        }
+    }
+
+    void Render::compactGeometry(const uint32_t vertex_capacity, const uint32_t index_capacity) {
+        // Frames in flight may still read the old buffers.
+        Vulkan::WaitDeviceIdle();
+
+        const Vulkan::Buffer old_vertex_buffer = m_VertexBuffer;
+        const Vulkan::Buffer old_index_buffer  = m_IndexBuffer;
+
+        m_VertexBuffer = Vulkan::AllocateBuffer(
+            old_vertex_buffer.AllocationFlags,
+            old_vertex_buffer.MemoryUsage,
+            old_vertex_buffer.CreateFlags,
+            sizeof(Vertex) * vertex_capacity,
+            old_vertex_buffer.Usage);
+
+        m_IndexBuffer = Vulkan::AllocateBuffer(
+            old_index_buffer.AllocationFlags,
+            old_index_buffer.MemoryUsage,
+            old_index_buffer.CreateFlags,
+            sizeof(uint32_t) * index_capacity,
+            old_index_buffer.Usage);
+
+        Vulkan::DestroyVirtualBlock(m_VertexBlock);
+        Vulkan::DestroyVirtualBlock(m_IndexBlock);
+
+        m_VertexBlock = Vulkan::CreateVirtualBlock(vertex_capacity);
+        m_IndexBlock  = Vulkan::CreateVirtualBlock(index_capacity);
+
+        std::vector<vk::BufferCopy2> vertex_regions{};
+        std::vector<vk::BufferCopy2> index_regions{};
+
+        for (Model &model : std::views::values(m_Models)) {
+            const GeometryAllocation old_vertex_allocation = model.VertexAllocation;
+            const GeometryAllocation old_index_allocation  = model.IndexAllocation;
+
+            model.VertexAllocation = AllocateGeometryRange(m_VertexBlock, old_vertex_allocation.Count).value();
+            model.IndexAllocation  = AllocateGeometryRange(m_IndexBlock, old_index_allocation.Count).value();
+
+            if (0 != old_vertex_allocation.Count) {
+                vertex_regions.push_back(vk::BufferCopy2{
+                    sizeof(Vertex) * old_vertex_allocation.Offset,
+                    sizeof(Vertex) * model.VertexAllocation.Offset,
+                    sizeof(Vertex) * old_vertex_allocation.Count,
+                });
+            }
+            if (0 != old_index_allocation.Count) {
+                index_regions.push_back(vk::BufferCopy2{
+                    sizeof(uint32_t) * old_index_allocation.Offset,
+                    sizeof(uint32_t) * model.IndexAllocation.Offset,
+                    sizeof(uint32_t) * old_index_allocation.Count,
+                });
+            }
+
+            for (auto &indirect_command : model.IndirectCommands) {
+                indirect_command.firstIndex += model.IndexAllocation.Offset - old_index_allocation.Offset;
+                indirect_command.vertexOffset += static_cast<int32_t>(model.VertexAllocation.Offset) -
+                                                 static_cast<int32_t>(old_vertex_allocation.Offset);
+            }
+        }
+
+        if (!vertex_regions.empty() || !index_regions.empty()) {
+            Vulkan::ImmediateSubmit([&](const vk::CommandBuffer command_buffer) {
+                if (!vertex_regions.empty())
+                    Vulkan::CopyBufferToBuffer(old_vertex_buffer.Handle, m_VertexBuffer.Handle, vertex_regions, command_buffer);
+                if (!index_regions.empty())
+                    Vulkan::CopyBufferToBuffer(old_index_buffer.Handle, m_IndexBuffer.Handle, index_regions, command_buffer);
+            });
+        }
+
+        m_pFrameGraph->removeBuffer(m_FrameGraphVertexBuffer.Buffer);
+        m_pFrameGraph->removeBuffer(m_FrameGraphIndexBuffer.Buffer);
+
+        Vulkan::DestroyBuffer(old_vertex_buffer);
+        Vulkan::DestroyBuffer(old_index_buffer);
+
+        m_FrameGraphVertexBuffer = FrameGraph::BufferInfo{
+            m_pFrameGraph->importBuffer(m_VertexBuffer.Handle, m_VertexBuffer.Usage, 0, m_VertexBuffer.Size),
+            0,
+            m_VertexBuffer.Size,
+            vk::PipelineStageFlagBits2::eVertexInput,
+        };
+
+        m_FrameGraphIndexBuffer = FrameGraph::BufferInfo{
+            m_pFrameGraph->importBuffer(m_IndexBuffer.Handle, m_IndexBuffer.Usage, 0, m_IndexBuffer.Size),
+            0,
+            m_IndexBuffer.Size,
+            vk::PipelineStageFlagBits2::eIndexInput,
+        };
+    }
+
+    void Render::readGeometryBuffers(FrameGraph::RenderPass &render_pass) const {
+        render_pass.readBuffers({
+            m_FrameGraphVertexBuffer,
+            m_FrameGraphIndexBuffer,
+        });
+    }
+
+    std::optional<Render::GeometryAllocation> AllocateGeometryRange(const vma::VirtualBlock virtual_block, const uint32_t count) {
+        vma::VirtualAllocationCreateInfo create_info{};
+        create_info.setSize(glm::max(count, 1u));
+
+        vk::DeviceSize offset = 0;
+
+        auto [result, allocation] = virtual_block.virtualAllocate(create_info, &offset);
+        if (vk::Result::eSuccess != result)
+            return std::nullopt;
+
+        return Render::GeometryAllocation{allocation, static_cast<uint32_t>(offset), count};
+    }
+}  // namespace Ignis
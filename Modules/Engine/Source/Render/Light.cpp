@@ -30,8 +30,8 @@ namespace Ignis {
         Vulkan::ImmediateSubmit([&](const vk::CommandBuffer command_buffer) {
             Vulkan::CopyBufferToBuffer(
                 s_pInstance->m_PointLightStagingBuffer.Handle,
-                s_pInstance->m_PointLightBuffer.Handle, 0,
-                sizeof(PointLight) * index,
+                s_pInstance->getPageBuffer(s_pInstance->m_PointLightPages, index), 0,
+                s_pInstance->getPageOffset(s_pInstance->m_PointLightPages, index),
                 sizeof(PointLight),
                 command_buffer);
         });
@@ -47,8 +47,8 @@ namespace Ignis {
         Vulkan::ImmediateSubmit([&](const vk::CommandBuffer command_buffer) {
             Vulkan::CopyBufferToBuffer(
                 s_pInstance->m_SpotLightStagingBuffer.Handle,
-                s_pInstance->m_SpotLightBuffer.Handle, 0,
-                sizeof(SpotLight) * index,
+                s_pInstance->getPageBuffer(s_pInstance->m_SpotLightPages, index), 0,
+                s_pInstance->getPageOffset(s_pInstance->m_SpotLightPages, index),
                 sizeof(SpotLight),
                 command_buffer);
         });
@@ -77,48 +77,15 @@ namespace Ignis {
             Vulkan::FlushAllocation(s_pInstance->m_LightDataBuffer.Allocation, offsetof(LightData, PointLightCount), sizeof(PointLightID));
         }
 
-        if (sizeof(PointLight) * index >= s_pInstance->m_PointLightBuffer.Size) {
-            s_pInstance->m_pFrameGraph->removeBuffer(s_pInstance->m_FrameGraphPointLightBuffer.Buffer);
-
-            const Vulkan::Buffer old_buffer = s_pInstance->m_PointLightBuffer;
-
-            s_pInstance->m_PointLightBuffer = Vulkan::AllocateBuffer(
-                old_buffer.AllocationFlags,
-                old_buffer.MemoryUsage,
-                old_buffer.CreateFlags,
-                old_buffer.Size * 2,
-                old_buffer.Usage);
-
-            s_pInstance->m_FrameGraphPointLightBuffer = FrameGraph::BufferInfo{
-                s_pInstance->m_pFrameGraph->importBuffer(s_pInstance->m_PointLightBuffer.Handle, s_pInstance->m_PointLightBuffer.Usage, 0, s_pInstance->m_PointLightBuffer.Size),
-                0,
-                s_pInstance->m_PointLightBuffer.Size,
-                vk::PipelineStageFlagBits2::eFragmentShader,
-            };
-
-            Vulkan::ImmediateSubmit([&](const vk::CommandBuffer command_buffer) {
-                Vulkan::CopyBufferToBuffer(
-                    old_buffer.Handle,
-                    s_pInstance->m_PointLightBuffer.Handle,
-                    0, 0,
-                    old_buffer.Size,
-                    command_buffer);
-            });
-
-            Vulkan::DestroyBuffer(old_buffer);
-
-            Vulkan::DescriptorSetWriter()
-                .writeStorageBuffer(1, s_pInstance->m_PointLightBuffer.Handle, 0, s_pInstance->m_PointLightBuffer.Size)
-                .update(s_pInstance->m_LightDescriptorSet);
-        }
+        s_pInstance->reservePages(s_pInstance->m_PointLightPages, index + 1);
 
         Vulkan::CopyMemoryToAllocation(&light, s_pInstance->m_PointLightStagingBuffer.Allocation, 0, sizeof(PointLight));
 
         Vulkan::ImmediateSubmit([&](const vk::CommandBuffer command_buffer) {
             Vulkan::CopyBufferToBuffer(
                 s_pInstance->m_PointLightStagingBuffer.Handle,
-                s_pInstance->m_PointLightBuffer.Handle, 0,
-                sizeof(PointLight) * index,
+                s_pInstance->getPageBuffer(s_pInstance->m_PointLightPages, index), 0,
+                s_pInstance->getPageOffset(s_pInstance->m_PointLightPages, index),
                 sizeof(PointLight),
                 command_buffer);
         });
@@ -153,48 +120,15 @@ namespace Ignis {
             Vulkan::FlushAllocation(s_pInstance->m_LightDataBuffer.Allocation, offsetof(LightData, SpotLightCount), sizeof(uint32_t));
         }
 
-        if (sizeof(SpotLight) * index >= s_pInstance->m_SpotLightBuffer.Size) {
-            s_pInstance->m_pFrameGraph->removeBuffer(s_pInstance->m_FrameGraphSpotLightBuffer.Buffer);
-
-            const Vulkan::Buffer old_buffer = s_pInstance->m_SpotLightBuffer;
-
-            s_pInstance->m_SpotLightBuffer = Vulkan::AllocateBuffer(
-                old_buffer.AllocationFlags,
-                old_buffer.MemoryUsage,
-                old_buffer.CreateFlags,
-                old_buffer.Size * 2,
-                old_buffer.Usage);
-
-            s_pInstance->m_FrameGraphSpotLightBuffer = FrameGraph::BufferInfo{
-                s_pInstance->m_pFrameGraph->importBuffer(s_pInstance->m_SpotLightBuffer.Handle, s_pInstance->m_SpotLightBuffer.Usage, 0, s_pInstance->m_SpotLightBuffer.Size),
-                0,
-                s_pInstance->m_SpotLightBuffer.Size,
-                vk::PipelineStageFlagBits2::eFragmentShader,
-            };
-
-            Vulkan::ImmediateSubmit([&](const vk::CommandBuffer command_buffer) {
-                Vulkan::CopyBufferToBuffer(
-                    old_buffer.Handle,
-                    s_pInstance->m_SpotLightBuffer.Handle,
-                    0, 0,
-                    old_buffer.Size,
-                    command_buffer);
-            });
-
-            Vulkan::DestroyBuffer(old_buffer);
-
-            Vulkan::DescriptorSetWriter()
-                .writeStorageBuffer(2, s_pInstance->m_SpotLightBuffer.Handle, 0, s_pInstance->m_SpotLightBuffer.Size)
-                .update(s_pInstance->m_LightDescriptorSet);
-        }
+        s_pInstance->reservePages(s_pInstance->m_SpotLightPages, index + 1);
 
         Vulkan::CopyMemoryToAllocation(&light, s_pInstance->m_SpotLightStagingBuffer.Allocation, 0, sizeof(SpotLight));
 
         Vulkan::ImmediateSubmit([&](const vk::CommandBuffer command_buffer) {
             Vulkan::CopyBufferToBuffer(
                 s_pInstance->m_SpotLightStagingBuffer.Handle,
-                s_pInstance->m_SpotLightBuffer.Handle, 0,
-                sizeof(SpotLight) * index,
+                s_pInstance->getPageBuffer(s_pInstance->m_SpotLightPages, index), 0,
+                s_pInstance->getPageOffset(s_pInstance->m_SpotLightPages, index),
                 sizeof(SpotLight),
                 command_buffer);
         });
@@ -226,10 +160,10 @@ namespace Ignis {
             last_index != index) {
             Vulkan::ImmediateSubmit([&](const vk::CommandBuffer command_buffer) {
                 Vulkan::CopyBufferToBuffer(
-                    s_pInstance->m_PointLightBuffer.Handle,
-                    s_pInstance->m_PointLightBuffer.Handle,
-                    sizeof(PointLight) * last_index,
-                    sizeof(PointLight) * index,
+                    s_pInstance->getPageBuffer(s_pInstance->m_PointLightPages, last_index),
+                    s_pInstance->getPageBuffer(s_pInstance->m_PointLightPages, index),
+                    s_pInstance->getPageOffset(s_pInstance->m_PointLightPages, last_index),
+                    s_pInstance->getPageOffset(s_pInstance->m_PointLightPages, index),
                     sizeof(PointLight),
                     command_buffer);
             });
@@ -267,10 +201,10 @@ namespace Ignis {
             last_index != index) {
             Vulkan::ImmediateSubmit([&](const vk::CommandBuffer command_buffer) {
                 Vulkan::CopyBufferToBuffer(
-                    s_pInstance->m_SpotLightBuffer.Handle,
-                    s_pInstance->m_SpotLightBuffer.Handle,
-                    sizeof(SpotLight) * last_index,
-                    sizeof(SpotLight) * index,
+                    s_pInstance->getPageBuffer(s_pInstance->m_SpotLightPages, last_index),
+                    s_pInstance->getPageBuffer(s_pInstance->m_SpotLightPages, index),
+                    s_pInstance->getPageOffset(s_pInstance->m_SpotLightPages, last_index),
+                    s_pInstance->getPageOffset(s_pInstance->m_SpotLightPages, index),
                     sizeof(SpotLight),
                     command_buffer);
             });
@@ -311,9 +245,9 @@ namespace Ignis {
 
         Vulkan::ImmediateSubmit([&](const vk::CommandBuffer command_buffer) {
             Vulkan::CopyBufferToBuffer(
-                s_pInstance->m_PointLightBuffer.Handle,
+                s_pInstance->getPageBuffer(s_pInstance->m_PointLightPages, index),
                 s_pInstance->m_PointLightStagingBuffer.Handle,
-                sizeof(PointLight) * index, 0,
+                s_pInstance->getPageOffset(s_pInstance->m_PointLightPages, index), 0,
                 sizeof(PointLight),
                 command_buffer);
         });
@@ -330,9 +264,9 @@ namespace Ignis {
 
         Vulkan::ImmediateSubmit([&](const vk::CommandBuffer command_buffer) {
             Vulkan::CopyBufferToBuffer(
-                s_pInstance->m_SpotLightBuffer.Handle,
+                s_pInstance->getPageBuffer(s_pInstance->m_SpotLightPages, index),
                 s_pInstance->m_SpotLightStagingBuffer.Handle,
-                sizeof(SpotLight) * index, 0,
+                s_pInstance->getPageOffset(s_pInstance->m_SpotLightPages, index), 0,
                 sizeof(SpotLight),
                 command_buffer);
         });
@@ -341,13 +275,25 @@ namespace Ignis {
         return light;
     }
 
-    void Render::initializeLights() {
+    void Render::initializeLights(const uint32_t max_binding_count) {
         m_LightDescriptorLayout =
             Vulkan::DescriptorSetLayoutBuilder()
                 .addUniformBuffer(0, vk::ShaderStageFlagBits::eFragment)
-                .addStorageBuffer(1, vk::ShaderStageFlagBits::eFragment)
-                .addStorageBuffer(2, vk::ShaderStageFlagBits::eFragment)
-                .addUniformBuffer(3, vk::ShaderStageFlagBits::eFragment)
+                .addStorageBuffer(
+                    vk::DescriptorBindingFlagBits::ePartiallyBound |
+                        vk::DescriptorBindingFlagBits::eUpdateAfterBind |
+                        vk::DescriptorBindingFlagBits::eUpdateUnusedWhilePending,
+                    1, max_binding_count, vk::ShaderStageFlagBits::eFragment | vk::ShaderStageFlagBits::eCompute)
+                .addStorageBuffer(
+                    vk::DescriptorBindingFlagBits::ePartiallyBound |
+                        vk::DescriptorBindingFlagBits::eUpdateAfterBind |
+                        vk::DescriptorBindingFlagBits::eUpdateUnusedWhilePending,
+                    2, max_binding_count, vk::ShaderStageFlagBits::eFragment | vk::ShaderStageFlagBits::eCompute)
+                .addUniformBuffer(3, vk::ShaderStageFlagBits::eFragment | vk::ShaderStageFlagBits::eCompute)
+                .addUniformBuffer(4, vk::ShaderStageFlagBits::eFragment | vk::ShaderStageFlagBits::eCompute)
+                .addStorageBuffer(5, vk::ShaderStageFlagBits::eFragment | vk::ShaderStageFlagBits::eCompute)
+                .addStorageBuffer(6, vk::ShaderStageFlagBits::eFragment | vk::ShaderStageFlagBits::eCompute)
+                .setFlags(vk::DescriptorSetLayoutCreateFlagBits::eUpdateAfterBindPool)
                 .build();
 
         m_LightDescriptorSet = Vulkan::AllocateDescriptorSet(m_LightDescriptorLayout, m_DescriptorPool);
@@ -383,19 +329,25 @@ namespace Ignis {
                 vk::BufferUsageFlagBits::eTransferSrc |
                 vk::BufferUsageFlagBits::eTransferDst);
 
-        m_PointLightBuffer = Vulkan::AllocateBuffer(
-            {}, vma::MemoryUsage::eGpuOnly, {},
-            sizeof(PointLight) * 2,
+        initializePagePool(
+            m_PointLightPages,
+            sizeof(PointLight), k_LightsPerPage,
             vk::BufferUsageFlagBits::eStorageBuffer |
-                vk::BufferUsageFlagBits::eTransferSrc |
-                vk::BufferUsageFlagBits::eTransferDst);
+                vk::BufferUsageFlagBits::eTransferSrc,
+            vk::PipelineStageFlagBits2::eFragmentShader,
+            UploadStrategy::eStaged,
+            m_LightDescriptorSet, 1);
+        reservePages(m_PointLightPages, 1);
 
-        m_SpotLightBuffer = Vulkan::AllocateBuffer(
-            {}, vma::MemoryUsage::eGpuOnly, {},
-            sizeof(SpotLight) * 2,
+        initializePagePool(
+            m_SpotLightPages,
+            sizeof(SpotLight), k_LightsPerPage,
             vk::BufferUsageFlagBits::eStorageBuffer |
-                vk::BufferUsageFlagBits::eTransferSrc |
-                vk::BufferUsageFlagBits::eTransferDst);
+                vk::BufferUsageFlagBits::eTransferSrc,
+            vk::PipelineStageFlagBits2::eFragmentShader,
+            UploadStrategy::eStaged,
+            m_LightDescriptorSet, 2);
+        reservePages(m_SpotLightPages, 1);
 
         m_LightDataBuffer = Vulkan::AllocateBuffer(
             vma::AllocationCreateFlagBits::eMapped |
@@ -420,20 +372,6 @@ namespace Ignis {
             vk::PipelineStageFlagBits2::eFragmentShader,
         };
 
-        m_FrameGraphPointLightBuffer = FrameGraph::BufferInfo{
-            m_pFrameGraph->importBuffer(m_PointLightBuffer.Handle, m_PointLightBuffer.Usage, 0, m_PointLightBuffer.Size),
-            0,
-            m_PointLightBuffer.Size,
-            vk::PipelineStageFlagBits2::eFragmentShader,
-        };
-
-        m_FrameGraphSpotLightBuffer = FrameGraph::BufferInfo{
-            m_pFrameGraph->importBuffer(m_SpotLightBuffer.Handle, m_SpotLightBuffer.Usage, 0, m_SpotLightBuffer.Size),
-            0,
-            m_SpotLightBuffer.Size,
-            vk::PipelineStageFlagBits2::eFragmentShader,
-        };
-
         m_FrameGraphLightDataBuffer = FrameGraph::BufferInfo{
             m_pFrameGraph->importBuffer(m_LightDataBuffer.Handle, m_LightDataBuffer.Usage, 0, m_LightDataBuffer.Size),
             0,
@@ -447,19 +385,87 @@ namespace Ignis {
         m_FreePointLightIDs.clear();
         m_FreeSpotLightIDs.clear();
 
+        // Lights are binned into view space clusters every frame, the shading pass only walks its own cluster.
+        m_ClusterDataBuffer = allocateUploadBuffer(
+            UploadStrategy::eStaged,
+            sizeof(ClusterData),
+            vk::BufferUsageFlagBits::eUniformBuffer);
+
+        m_ClusterGridBuffer = Vulkan::AllocateBuffer(
+            {}, vma::MemoryUsage::eGpuOnly, {},
+            sizeof(glm::uvec2) * k_ClusterCount,
+            vk::BufferUsageFlagBits::eStorageBuffer);
+
+        m_ClusterLightIndexBuffer = Vulkan::AllocateBuffer(
+            {}, vma::MemoryUsage::eGpuOnly, {},
+            sizeof(uint32_t) * k_ClusterCount * k_MaxLightsPerCluster,
+            vk::BufferUsageFlagBits::eStorageBuffer);
+
+        m_FrameGraphClusterDataBuffer = FrameGraph::BufferInfo{
+            m_pFrameGraph->importBuffer(m_ClusterDataBuffer.Handle, m_ClusterDataBuffer.Usage, 0, m_ClusterDataBuffer.Size),
+            0,
+            m_ClusterDataBuffer.Size,
+            vk::PipelineStageFlagBits2::eFragmentShader,
+        };
+
+        m_FrameGraphClusterGridBuffer = FrameGraph::BufferInfo{
+            m_pFrameGraph->importBuffer(m_ClusterGridBuffer.Handle, m_ClusterGridBuffer.Usage, 0, m_ClusterGridBuffer.Size),
+            0,
+            m_ClusterGridBuffer.Size,
+            vk::PipelineStageFlagBits2::eFragmentShader,
+        };
+
+        m_FrameGraphClusterLightIndexBuffer = FrameGraph::BufferInfo{
+            m_pFrameGraph->importBuffer(m_ClusterLightIndexBuffer.Handle, m_ClusterLightIndexBuffer.Usage, 0, m_ClusterLightIndexBuffer.Size),
+            0,
+            m_ClusterLightIndexBuffer.Size,
+            vk::PipelineStageFlagBits2::eFragmentShader,
+        };
+
         Vulkan::DescriptorSetWriter()
             .writeUniformBuffer(0, m_DirectionalLightBuffer.Handle, 0, m_DirectionalLightBuffer.Size)
-            .writeStorageBuffer(1, m_PointLightBuffer.Handle, 0, m_PointLightBuffer.Size)
-            .writeStorageBuffer(2, m_SpotLightBuffer.Handle, 0, m_SpotLightBuffer.Size)
             .writeUniformBuffer(3, m_LightDataBuffer.Handle, 0, m_LightDataBuffer.Size)
+            .writeUniformBuffer(4, m_ClusterDataBuffer.Handle, 0, m_ClusterDataBuffer.Size)
+            .writeStorageBuffer(5, m_ClusterGridBuffer.Handle, 0, m_ClusterGridBuffer.Size)
+            .writeStorageBuffer(6, m_ClusterLightIndexBuffer.Handle, 0, m_ClusterLightIndexBuffer.Size)
             .update(m_LightDescriptorSet);
+
+        const FileAsset light_cull_shader_file = FileAsset::LoadBinaryFromPath("Assets/Shaders/Ignis/LightCull.spv").value();
+
+        std::vector<uint32_t> light_cull_shader_code{};
+        light_cull_shader_code.resize(light_cull_shader_file.getSize() * sizeof(char) / sizeof(uint32_t));
+
+        std::memcpy(light_cull_shader_code.data(), light_cull_shader_file.getContent().data(), light_cull_shader_file.getSize());
+
+        const vk::ShaderModule light_cull_shader = Vulkan::CreateShaderModuleFromSPV(light_cull_shader_code);
+
+        m_LightCullPipelineLayout = Vulkan::CreatePipelineLayout(
+            nullptr,
+            {m_MaterialDescriptorLayout, m_LightDescriptorLayout});
+
+        m_LightCullPipeline = Vulkan::CreateComputePipeline({}, "cs_cull", light_cull_shader, m_LightCullPipelineLayout);
+
+        Vulkan::DestroyShaderModule(light_cull_shader);
     }
 
     void Render::releaseLights() {
+        Vulkan::DestroyPipeline(m_LightCullPipeline);
+        Vulkan::DestroyPipelineLayout(m_LightCullPipelineLayout);
+
         m_pFrameGraph->removeBuffer(m_FrameGraphDirectionalLightBuffer.Buffer);
-        m_pFrameGraph->removeBuffer(m_FrameGraphPointLightBuffer.Buffer);
-        m_pFrameGraph->removeBuffer(m_FrameGraphSpotLightBuffer.Buffer);
         m_pFrameGraph->removeBuffer(m_FrameGraphLightDataBuffer.Buffer);
+        m_pFrameGraph->removeBuffer(m_FrameGraphClusterDataBuffer.Buffer);
+        m_pFrameGraph->removeBuffer(m_FrameGraphClusterGridBuffer.Buffer);
+        m_pFrameGraph->removeBuffer(m_FrameGraphClusterLightIndexBuffer.Buffer);
+
+        discardUploads(m_ClusterDataBuffer.Handle);
+
+        Vulkan::DestroyBuffer(m_ClusterDataBuffer);
+        Vulkan::DestroyBuffer(m_ClusterGridBuffer);
+        Vulkan::DestroyBuffer(m_ClusterLightIndexBuffer);
+
+        releasePagePool(m_PointLightPages);
+        releasePagePool(m_SpotLightPages);
 
         Vulkan::DestroyDescriptorSetLayout(m_LightDescriptorLayout);
 
@@ -468,23 +474,98 @@ namespace Ignis {
         Vulkan::DestroyBuffer(m_SpotLightStagingBuffer);
 
         Vulkan::DestroyBuffer(m_DirectionalLightBuffer);
-        Vulkan::DestroyBuffer(m_PointLightBuffer);
-        Vulkan::DestroyBuffer(m_SpotLightBuffer);
         Vulkan::DestroyBuffer(m_LightDataBuffer);
 
-        m_FrameGraphDirectionalLightBuffer.Buffer = FrameGraph::k_InvalidBufferID;
-        m_FrameGraphPointLightBuffer.Buffer       = FrameGraph::k_InvalidBufferID;
-        m_FrameGraphSpotLightBuffer.Buffer        = FrameGraph::k_InvalidBufferID;
-        m_FrameGraphLightDataBuffer.Buffer        = FrameGraph::k_InvalidBufferID;
+        m_FrameGraphDirectionalLightBuffer.Buffer  = FrameGraph::k_InvalidBufferID;
+        m_FrameGraphLightDataBuffer.Buffer         = FrameGraph::k_InvalidBufferID;
+        m_FrameGraphClusterDataBuffer.Buffer       = FrameGraph::k_InvalidBufferID;
+        m_FrameGraphClusterGridBuffer.Buffer       = FrameGraph::k_InvalidBufferID;
+        m_FrameGraphClusterLightIndexBuffer.Buffer = FrameGraph::k_InvalidBufferID;
     }
 
     void Render::readLightBuffers(FrameGraph::RenderPass &render_pass) {
         render_pass
             .readBuffers({
                 m_FrameGraphDirectionalLightBuffer,
-                m_FrameGraphPointLightBuffer,
-                m_FrameGraphSpotLightBuffer,
                 m_FrameGraphLightDataBuffer,
+                m_FrameGraphClusterDataBuffer,
+                m_FrameGraphClusterGridBuffer,
+                m_FrameGraphClusterLightIndexBuffer,
+            });
+
+        readPagePool(m_PointLightPages, render_pass);
+        readPagePool(m_SpotLightPages, render_pass);
+    }
+
+    void Render::updateLightClusters() {
+        const vk::Extent3D color_extent = m_pFrameGraph->getImageExtent(m_ColorImage);
+
+        // glm::perspective with zero to one depth stores both planes in the third column.
+        const glm::f32 near = m_Camera.Projection[3][2] / m_Camera.Projection[2][2];
+        const glm::f32 far  = m_Camera.Projection[3][2] / (m_Camera.Projection[2][2] + 1.0f);
+
+        const ClusterData cluster_data{
+            m_Camera.View,
+            glm::inverse(m_Camera.Projection),
+            glm::vec2{color_extent.width, color_extent.height},
+            near,
+            far,
+        };
+
+        uploadToBuffer(m_ClusterDataBuffer, 0, &cluster_data, sizeof(ClusterData));
+    }
+
+    void Render::recordLightCulling(FrameGraph &frame_graph) {
+        const auto compute_info = [](FrameGraph::BufferInfo info) {
+            info.StageMask = vk::PipelineStageFlagBits2::eComputeShader;
+            return info;
+        };
+
+        FrameGraph::ComputePass light_cull_pass{
+            "Ignis::Render::Light Cull Pass",
+            {1.0f, 1.0f, 0.5f, 1.0f},
+        };
+
+        light_cull_pass
+            .readBuffer(compute_info(m_FrameGraphLightDataBuffer))
+            .readBuffer(compute_info(m_FrameGraphClusterDataBuffer))
+            .writeBuffer(compute_info(m_FrameGraphClusterGridBuffer))
+            .writeBuffer(compute_info(m_FrameGraphClusterLightIndexBuffer));
+
+        for (const FrameGraph::BufferInfo &info : m_PointLightPages.FrameGraphPages)
+            light_cull_pass.readBuffer(compute_info(info));
+        for (const FrameGraph::BufferInfo &info : m_SpotLightPages.FrameGraphPages)
+            light_cull_pass.readBuffer(compute_info(info));
+
+        light_cull_pass.setExecute(
+            [this,
+             cluster_grid_buffer        = m_ClusterGridBuffer.Handle,
+             cluster_light_index_buffer = m_ClusterLightIndexBuffer.Handle](const vk::CommandBuffer command_buffer) {
+                // Earlier frames may still be shading from the cluster lists.
+                Vulkan::BarrierMerger merger{};
+                merger.putBufferBarrier(
+                    cluster_grid_buffer, 0, vk::WholeSize,
+                    vk::PipelineStageFlagBits2::eFragmentShader,
+                    vk::AccessFlagBits2::eNone,
+                    vk::PipelineStageFlagBits2::eComputeShader,
+                    vk::AccessFlagBits2::eShaderStorageWrite);
+                merger.putBufferBarrier(
+                    cluster_light_index_buffer, 0, vk::WholeSize,
+                    vk::PipelineStageFlagBits2::eFragmentShader,
+                    vk::AccessFlagBits2::eNone,
+                    vk::PipelineStageFlagBits2::eComputeShader,
+                    vk::AccessFlagBits2::eShaderStorageWrite);
+                merger.flushBarriers(command_buffer);
+
+                command_buffer.bindPipeline(vk::PipelineBindPoint::eCompute, m_LightCullPipeline);
+                command_buffer.bindDescriptorSets(
+                    vk::PipelineBindPoint::eCompute,
+                    m_LightCullPipelineLayout, 1,
+                    {m_LightDescriptorSet}, {});
+
+                command_buffer.dispatch(1, 1, k_ClusterGridSizeZ);
             });
+
+        frame_graph.addComputePass(light_cull_pass);
     }
 }  // namespace Ignis
\ No newline at end of file
@@ -4,15 +4,32 @@ namespace Ignis {
     void Render::initializeMaterials(const uint32_t max_binding_count) {
         m_MaterialDescriptorLayout =
             Vulkan::DescriptorSetLayoutBuilder()
-                .addCombinedImageSampler(0, max_binding_count, vk::ShaderStageFlagBits::eFragment)
+                .addCombinedImageSampler(
+                    vk::DescriptorBindingFlagBits::ePartiallyBound |
+                        vk::DescriptorBindingFlagBits::eUpdateAfterBind |
+                        vk::DescriptorBindingFlagBits::eUpdateUnusedWhilePending,
+                    0, max_binding_count, vk::ShaderStageFlagBits::eFragment)
                 .addCombinedImageSampler(1, vk::ShaderStageFlagBits::eFragment)
                 .addCombinedImageSampler(2, vk::ShaderStageFlagBits::eFragment)
                 .addCombinedImageSampler(3, vk::ShaderStageFlagBits::eFragment)
-                .addStorageBuffer(4, vk::ShaderStageFlagBits::eFragment)
+                .addStorageBuffer(
+                    vk::DescriptorBindingFlagBits::ePartiallyBound |
+                        vk::DescriptorBindingFlagBits::eUpdateAfterBind |
+                        vk::DescriptorBindingFlagBits::eUpdateUnusedWhilePending,
+                    4, max_binding_count, vk::ShaderStageFlagBits::eFragment)
+                .addStorageBuffer(
+                    vk::DescriptorBindingFlagBits::ePartiallyBound |
+                        vk::DescriptorBindingFlagBits::eUpdateAfterBind |
+                        vk::DescriptorBindingFlagBits::eUpdateUnusedWhilePending,
+                    5, max_binding_count, vk::ShaderStageFlagBits::eFragment)
+                .addStorageBuffer(6, vk::ShaderStageFlagBits::eFragment)
+                .setFlags(vk::DescriptorSetLayoutCreateFlagBits::eUpdateAfterBindPool)
                 .build();
 
         m_MaterialDescriptorSet = Vulkan::AllocateDescriptorSet(m_MaterialDescriptorLayout, m_DescriptorPool);
 
+        m_TextureSlotCount = max_binding_count;
+
         m_MaterialStagingBuffer = Vulkan::AllocateBuffer(
             vma::AllocationCreateFlagBits::eMapped |
                 vma::AllocationCreateFlagBits::eHostAccessRandom,
@@ -21,18 +38,25 @@ namespace Ignis {
             vk::BufferUsageFlagBits::eTransferSrc |
                 vk::BufferUsageFlagBits::eTransferDst);
 
-        m_MaterialBuffer = Vulkan::AllocateBuffer(
-            {}, vma::MemoryUsage::eGpuOnly, {},
-            sizeof(Material) * 2,
+        initializePagePool(
+            m_MaterialPages,
+            sizeof(Material), k_MaterialsPerPage,
             vk::BufferUsageFlagBits::eStorageBuffer |
-                vk::BufferUsageFlagBits::eTransferSrc |
-                vk::BufferUsageFlagBits::eTransferDst);
-
-        m_FrameGraphMaterialBuffer = FrameGraph::BufferInfo{
-            m_pFrameGraph->importBuffer(m_MaterialBuffer.Handle, m_MaterialBuffer.Usage, 0, m_MaterialBuffer.Size),
-            0,
-            m_MaterialBuffer.Size,
-            vk::PipelineStageFlagBits2::eFragmentShader};
+                vk::BufferUsageFlagBits::eTransferSrc,
+            vk::PipelineStageFlagBits2::eFragmentShader,
+            UploadStrategy::eStaged,
+            m_MaterialDescriptorSet, 4);
+        reservePages(m_MaterialPages, 1);
+
+        // Staged, so a rebuilt image is never bound for a frame in flight before the copies that fill it.
+        initializePagePool(
+            m_TexturePages,
+            sizeof(TextureState), k_TexturesPerPage,
+            vk::BufferUsageFlagBits::eStorageBuffer,
+            vk::PipelineStageFlagBits2::eFragmentShader,
+            UploadStrategy::eStaged,
+            m_MaterialDescriptorSet, 5);
+        reservePages(m_TexturePages, 1);
 
         m_NextTextureID.ID  = 0u;
         m_NextMaterialID.ID = 0u;
@@ -46,9 +70,10 @@ namespace Ignis {
             .writeCombinedImageSampler(1, m_BRDFLUTImageView, vk::ImageLayout::eShaderReadOnlyOptimal, m_Sampler)
             .writeCombinedImageSampler(2, m_PrefilterImageView, vk::ImageLayout::eShaderReadOnlyOptimal, m_Sampler)
             .writeCombinedImageSampler(3, m_IrradianceImageView, vk::ImageLayout::eShaderReadOnlyOptimal, m_Sampler)
-            .writeStorageBuffer(4, m_MaterialBuffer.Handle, 0, m_MaterialBuffer.Size)
             .update(m_MaterialDescriptorSet);
 
+        allocateTextureFeedbackBuffer(k_TexturesPerPage);
+
         initializeDefaultMaps();
     }
 
@@ -65,10 +90,12 @@ namespace Ignis {
                 removeTextureRC(texture_id);
         }
 
-        m_pFrameGraph->removeBuffer(m_FrameGraphMaterialBuffer.Buffer);
+        releasePagePool(m_MaterialPages);
+        releasePagePool(m_TexturePages);
+
+        releaseTextureFeedbackBuffer();
 
         Vulkan::DestroyBuffer(m_MaterialStagingBuffer);
-        Vulkan::DestroyBuffer(m_MaterialBuffer);
 
         Vulkan::DestroyDescriptorSetLayout(m_MaterialDescriptorLayout);
     }
@@ -93,7 +120,7 @@ namespace Ignis {
         return m_MetallicRoughnessTexture;
     }
 
-    Render::TextureID Render::addTexture(const Vulkan::Image &image, const vk::ImageView view) {
+    Render::TextureID Render::addTexture(const Vulkan::Image &image, const vk::ImageView view, const uint32_t first_mip_level) {
         TextureID id;
 
         if (m_FreeTextureIDs.empty()) {
@@ -104,6 +131,12 @@ namespace Ignis {
             m_FreeTextureIDs.pop_back();
         }
 
+        // Streaming swaps a texture between its two slots, so the binding holds half as many textures as slots.
+        DIGNIS_ASSERT(GetTextureSlot(id, 1) < m_TextureSlotCount, "Ignis::Render is out of texture slots, raise MaxBindingCount.");
+
+        if (id.ID >= m_TextureFeedbackCapacity)
+            allocateTextureFeedbackBuffer(2 * m_TextureFeedbackCapacity);
+
         m_FrameGraphImages.insert(
             id,
             m_pFrameGraph->importImage(
@@ -113,12 +146,14 @@ namespace Ignis {
                 vk::ImageLayout::eShaderReadOnlyOptimal));
 
         Vulkan::DescriptorSetWriter()
-            .writeCombinedImageSampler(0, id.ID, view, vk::ImageLayout::eShaderReadOnlyOptimal, m_Sampler)
+            .writeCombinedImageSampler(0, GetTextureSlot(id, 0), view, vk::ImageLayout::eShaderReadOnlyOptimal, m_TextureSampler)
             .update(m_MaterialDescriptorSet);
 
         m_Textures.emplace(id, image);
         m_TextureViews.emplace(id, view);
 
+        setTextureState(id, TextureState{GetTextureSlot(id, 0), first_mip_level});
+
         return id;
     }
 
@@ -133,59 +168,38 @@ namespace Ignis {
             m_FreeMaterialIDs.pop_back();
         }
 
-        if (sizeof(Material) * id.ID >= m_MaterialBuffer.Size) {
-            m_pFrameGraph->removeBuffer(m_FrameGraphMaterialBuffer.Buffer);
-
-            const Vulkan::Buffer old_buffer = m_MaterialBuffer;
-
-            const auto old_stage_mask = m_FrameGraphMaterialBuffer.StageMask;
-
-            m_MaterialBuffer = Vulkan::AllocateBuffer(
-                old_buffer.AllocationFlags,
-                old_buffer.MemoryUsage,
-                old_buffer.CreateFlags,
-                old_buffer.Size * 2,
-                old_buffer.Usage);
-
-            m_FrameGraphMaterialBuffer = FrameGraph::BufferInfo{
-                m_pFrameGraph->importBuffer(m_MaterialBuffer.Handle, m_MaterialBuffer.Usage, 0, m_MaterialBuffer.Size),
-                0,
-                m_MaterialBuffer.Size,
-                old_stage_mask,
-            };
-
-            Vulkan::ImmediateSubmit([&](const vk::CommandBuffer command_buffer) {
-                Vulkan::CopyBufferToBuffer(
-                    old_buffer.Handle,
-                    m_MaterialBuffer.Handle,
-                    0, 0,
-                    old_buffer.Size,
-                    command_buffer);
-            });
-
-            Vulkan::DestroyBuffer(old_buffer);
-
-            Vulkan::DescriptorSetWriter()
-                .writeStorageBuffer(4, m_MaterialBuffer.Handle, 0, m_MaterialBuffer.Size)
-                .update(m_MaterialDescriptorSet);
-        }
+        reservePages(m_MaterialPages, id.ID + 1);
 
         Vulkan::CopyMemoryToAllocation(&material, m_MaterialStagingBuffer.Allocation, 0, sizeof(Material));
 
         Vulkan::ImmediateSubmit([&](const vk::CommandBuffer command_buffer) {
             Vulkan::CopyBufferToBuffer(
                 m_MaterialStagingBuffer.Handle,
-                m_MaterialBuffer.Handle, 0,
-                sizeof(Material) * id.ID,
+                getPageBuffer(m_MaterialPages, id.ID), 0,
+                getPageOffset(m_MaterialPages, id.ID),
                 sizeof(Material),
                 command_buffer);
         });
 
         m_Materials.insert(id);
+        m_MaterialFeatures.insert_or_assign(id, material.Features);
 
         return id;
     }
 
+    uint32_t Render::GetTextureSlot(const TextureID id, const uint32_t parity) {
+        return 2 * id.ID + parity;
+    }
+
+    void Render::setTextureState(const TextureID id, const TextureState &state) {
+        reservePages(m_TexturePages, id.ID + 1);
+
+        uploadToBuffer(
+            m_TexturePages.Pages[id.ID / m_TexturePages.ElementsPerPage],
+            getPageOffset(m_TexturePages, id.ID),
+            &state, sizeof(TextureState));
+    }
+
     void Render::removeTextureRC(const TextureID id) {
         DIGNIS_ASSERT(m_Textures.contains(id));
 
@@ -193,7 +207,9 @@ namespace Ignis {
         if (0 != m_LoadedTextureRCs.at(id))
             return;
 
-        const std::string path = m_LoadedTexturePaths.at(id);
+        const std::string key = m_LoadedTextureKeys.at(id);
+
+        stopTextureStream(id);
 
         m_pFrameGraph->removeImage(m_FrameGraphImages[id]);
         m_FrameGraphImages.remove(id);
@@ -202,7 +218,8 @@ namespace Ignis {
         const vk::ImageView view  = m_TextureViews.at(id);
 
         Vulkan::DescriptorSetWriter()
-            .writeCombinedImageSampler(0, id.ID, nullptr, vk::ImageLayout::eUndefined, m_Sampler)
+            .writeCombinedImageSampler(0, GetTextureSlot(id, 0), nullptr, vk::ImageLayout::eUndefined, m_TextureSampler)
+            .writeCombinedImageSampler(0, GetTextureSlot(id, 1), nullptr, vk::ImageLayout::eUndefined, m_TextureSampler)
             .update(m_MaterialDescriptorSet);
 
         Vulkan::DestroyImageView(view);
@@ -211,8 +228,8 @@ namespace Ignis {
         m_Textures.erase(id);
         m_TextureViews.erase(id);
 
-        m_LoadedTextures.erase(path);
-        m_LoadedTexturePaths.erase(id);
+        m_LoadedTextures.erase(key);
+        m_LoadedTextureKeys.erase(id);
         m_LoadedTextureRCs.erase(id);
 
         m_FreeTextureIDs.emplace_back(id);
@@ -245,6 +262,7 @@ namespace Ignis {
         const std::string path = m_LoadedMaterialPaths.at(id);
 
         m_Materials.erase(id);
+        m_MaterialFeatures.erase(id);
 
         m_LoadedMaterials.erase(path);
         m_LoadedMaterialPaths.erase(id);
@@ -258,9 +276,9 @@ namespace Ignis {
 
         Vulkan::ImmediateSubmit([&](const vk::CommandBuffer command_buffer) {
             Vulkan::CopyBufferToBuffer(
-                m_MaterialBuffer.Handle,
+                getPageBuffer(m_MaterialPages, id.ID),
                 m_MaterialStagingBuffer.Handle,
-                sizeof(Material) * id.ID, 0,
+                getPageOffset(m_MaterialPages, id.ID), 0,
                 sizeof(Material),
                 command_buffer);
         });
@@ -277,6 +295,7 @@ namespace Ignis {
     }
 
     void Render::readMaterialBuffers(FrameGraph::RenderPass &render_pass) const {
-        render_pass.readBuffers(m_FrameGraphMaterialBuffer);
+        readPagePool(m_TexturePages, render_pass);
+        readPagePool(m_MaterialPages, render_pass);
     }
 }  // namespace Ignis
\ No newline at end of file
@@ -3,27 +3,21 @@
 namespace Ignis {
     vk::ShaderModule g_ModelShader = nullptr;
 
-    struct SMikkTSpaceMesh {
-        uint32_t IndexCount = 0;
+    std::optional<FileAsset> LoadTextureFile(
+        const Render::CookedModel   &cooked_model,
+        const Render::CookedTexture &texture,
+        const std::filesystem::path &texture_path);
 
-        uint32_t       *Indices  = nullptr;
-        Render::Vertex *Vertices = nullptr;
-    };
-
-    SMikkTSpaceInterface g_SMikkTSpaceInterface{};
-
-    int32_t GetSMikkTSpaceNumFaces(const SMikkTSpaceContext *context);
-    int32_t GetSMikkTSpaceNumVerticesPerFace(const SMikkTSpaceContext *context, int32_t i_face);
-
-    void GetSMikkTSpacePosition(const SMikkTSpaceContext *context, glm::f32 o_fv_position[3], int32_t i_face, int32_t i_vertex);
-    void GetSMikkTSpaceNormal(const SMikkTSpaceContext *context, glm::f32 o_fv_normal[3], int32_t i_face, int32_t i_vertex);
-    void GetSMikkTSpaceUV(const SMikkTSpaceContext *context, glm::f32 o_fv_uv[2], int32_t i_face, int32_t i_vertex);
-
-    void SetSMikkTSpaceBasic(const SMikkTSpaceContext *context, const glm::f32 fv_tangent[3], glm::f32 f_sign, int32_t i_face, int32_t i_vertex);
+    uint64_t GetTextureImportKey(uint32_t texture_index, Render::TextureRole role);
 
     void Render::SetInstance(const InstanceID id, const glm::mat4x4 &transform) {
         DIGNIS_ASSERT(nullptr != s_pInstance, "Ignis::Render is not initialized.");
-        return s_pInstance->setInstance(id, transform);
+        return s_pInstance->setInstances({&id, 1}, {&transform, 1});
+    }
+
+    void Render::SetInstances(const std::span<const InstanceID> ids, const std::span<const glm::mat4x4> transforms) {
+        DIGNIS_ASSERT(nullptr != s_pInstance, "Ignis::Render is not initialized.");
+        return s_pInstance->setInstances(ids, transforms);
     }
 
     Render::ModelID Render::AddModel(const std::filesystem::path &path) {
@@ -33,7 +27,12 @@ namespace Ignis {
 
     Render::InstanceID Render::AddInstance(const ModelID model_id, const glm::mat4x4 &transform) {
         DIGNIS_ASSERT(nullptr != s_pInstance, "Ignis::Render is not initialized.");
-        return s_pInstance->addInstance(model_id, transform);
+        return s_pInstance->addInstances(model_id, {&transform, 1}).front();
+    }
+
+    std::vector<Render::InstanceID> Render::AddInstances(const ModelID model_id, const std::span<const glm::mat4x4> transforms) {
+        DIGNIS_ASSERT(nullptr != s_pInstance, "Ignis::Render is not initialized.");
+        return s_pInstance->addInstances(model_id, transforms);
     }
 
     void Render::RemoveModel(const ModelID id) {
@@ -43,7 +42,12 @@ namespace Ignis {
 
     void Render::RemoveInstance(const InstanceID id) {
         DIGNIS_ASSERT(nullptr != s_pInstance, "Ignis::Render is not initialized.");
-        return s_pInstance->removeInstance(id);
+        return s_pInstance->removeInstances({&id, 1});
+    }
+
+    void Render::RemoveInstances(const std::span<const InstanceID> ids) {
+        DIGNIS_ASSERT(nullptr != s_pInstance, "Ignis::Render is not initialized.");
+        return s_pInstance->removeInstances(ids);
     }
 
     std::string_view Render::GetModelPath(const ModelID id) {
@@ -51,26 +55,68 @@ namespace Ignis {
         return s_pInstance->getModelPath(id);
     }
 
+    const Render::Model &Render::GetModel(const ModelID id) {
+        DIGNIS_ASSERT(nullptr != s_pInstance, "Ignis::Render is not initialized.");
+        return s_pInstance->getModel(id);
+    }
+
+    Render::Mesh Render::GetMesh(const MeshID id) {
+        DIGNIS_ASSERT(nullptr != s_pInstance, "Ignis::Render is not initialized.");
+        return s_pInstance->getMesh(id);
+    }
+
     glm::mat4x4 Render::GetInstance(const InstanceID id) {
         DIGNIS_ASSERT(nullptr != s_pInstance, "Ignis::Render is not initialized.");
         return s_pInstance->getInstance(id);
     }
 
-    void Render::initializeModels(const uint32_t max_binding_count) {
+    void Render::initializeModels(const Settings &settings) {
         m_ModelDescriptorLayout =
             Vulkan::DescriptorSetLayoutBuilder()
-                .addStorageBuffer(0, max_binding_count, vk::ShaderStageFlagBits::eVertex)
-                .addStorageBuffer(1, max_binding_count, vk::ShaderStageFlagBits::eVertex)
+                .addStorageBuffer(0, settings.MaxBindingCount, vk::ShaderStageFlagBits::eVertex | vk::ShaderStageFlagBits::eCompute)
+                .addStorageBuffer(
+                    vk::DescriptorBindingFlagBits::ePartiallyBound |
+                        vk::DescriptorBindingFlagBits::eUpdateAfterBind |
+                        vk::DescriptorBindingFlagBits::eUpdateUnusedWhilePending,
+                    1, settings.MaxBindingCount, vk::ShaderStageFlagBits::eVertex | vk::ShaderStageFlagBits::eCompute)
+                .addStorageBuffer(
+                    vk::DescriptorBindingFlagBits::ePartiallyBound |
+                        vk::DescriptorBindingFlagBits::eUpdateAfterBind |
+                        vk::DescriptorBindingFlagBits::eUpdateUnusedWhilePending,
+                    2, settings.MaxBindingCount, vk::ShaderStageFlagBits::eVertex | vk::ShaderStageFlagBits::eCompute)
+                .addStorageBuffer(3, vk::ShaderStageFlagBits::eVertex | vk::ShaderStageFlagBits::eCompute)
+                .addStorageBuffer(4, vk::ShaderStageFlagBits::eCompute)
+                .addStorageBuffer(5, vk::ShaderStageFlagBits::eCompute)
+                .addStorageBuffer(6, vk::ShaderStageFlagBits::eVertex | vk::ShaderStageFlagBits::eCompute)
+                .addStorageBuffer(7, vk::ShaderStageFlagBits::eCompute)
+                .addStorageBuffer(8, vk::ShaderStageFlagBits::eCompute)
+                .setFlags(vk::DescriptorSetLayoutCreateFlagBits::eUpdateAfterBindPool)
                 .build();
 
+        m_InstanceUploadStrategy = settings.InstanceUploadStrategy;
+        m_DepthPrePass           = settings.DepthPrePass;
+
+        // Without BC support textures are uploaded as RGBA8 and cooked BC textures are not looked up.
+        m_SupportsBlockCompression = Vulkan::GetPhysicalDevice().getFeatures().textureCompressionBC;
+        m_CompressTextures         = settings.CompressTextures && m_SupportsBlockCompression;
+
         m_ModelPipelineLayout = Vulkan::CreatePipelineLayout(
             vk::PushConstantRange{
                 vk::ShaderStageFlagBits::eVertex | vk::ShaderStageFlagBits::eFragment,
-                0, sizeof(CameraPC) + sizeof(ModelID) + sizeof(glm::f32)},
+                0, sizeof(DrawPC)},
             {m_MaterialDescriptorLayout, m_LightDescriptorLayout, m_ModelDescriptorLayout});
 
         m_ModelDescriptorSet = Vulkan::AllocateDescriptorSet(m_ModelDescriptorLayout, m_DescriptorPool);
 
+        initializePagePool(
+            m_InstancePages,
+            sizeof(Instance), k_InstancesPerPage,
+            vk::BufferUsageFlagBits::eStorageBuffer |
+                vk::BufferUsageFlagBits::eTransferSrc,
+            vk::PipelineStageFlagBits2::eVertexShader,
+            m_InstanceUploadStrategy,
+            m_ModelDescriptorSet, 1);
+
         m_NextMeshID.ID     = 0;
         m_NextInstanceID.ID = 0;
         m_NextModelID.ID    = 0;
@@ -87,14 +133,6 @@ namespace Ignis {
         std::memcpy(model_shader_code.data(), model_shader_file.getContent().data(), model_shader_file.getSize());
 
         g_ModelShader = Vulkan::CreateShaderModuleFromSPV(model_shader_code);
-
-        g_SMikkTSpaceInterface.m_getNumFaces          = GetSMikkTSpaceNumFaces;
-        g_SMikkTSpaceInterface.m_getNumVerticesOfFace = GetSMikkTSpaceNumVerticesPerFace;
-        g_SMikkTSpaceInterface.m_getPosition          = GetSMikkTSpacePosition;
-        g_SMikkTSpaceInterface.m_getNormal            = GetSMikkTSpaceNormal;
-        g_SMikkTSpaceInterface.m_getTexCoord          = GetSMikkTSpaceUV;
-        g_SMikkTSpaceInterface.m_setTSpaceBasic       = SetSMikkTSpaceBasic;
-        g_SMikkTSpaceInterface.m_setTSpace            = nullptr;
     }
 
     void Render::releaseModels() {
@@ -104,7 +142,14 @@ namespace Ignis {
                 RemoveModel(model);
         }
 
-        Vulkan::DestroyPipeline(m_ModelPipeline);
+        releasePagePool(m_InstancePages);
+
+        for (const vk::Pipeline pipeline : std::views::values(m_ModelPipelines))
+            Vulkan::DestroyPipeline(pipeline);
+
+        m_ModelPipelines.clear();
+
+        Vulkan::DestroyPipeline(m_ModelDepthPipeline);
         Vulkan::DestroyShaderModule(g_ModelShader);
         Vulkan::DestroyPipelineLayout(m_ModelPipelineLayout);
         Vulkan::DestroyDescriptorSetLayout(m_ModelDescriptorLayout);
@@ -117,11 +162,47 @@ namespace Ignis {
     void Render::setModelViewport(
         const FrameGraph::ImageID color_image,
         const FrameGraph::ImageID depth_image) {
-        if (nullptr == m_ModelPipeline) {
-            m_ModelPipeline =
+        m_ModelColorFormat = m_pFrameGraph->getImageFormat(color_image);
+        m_ModelDepthFormat = m_pFrameGraph->getImageFormat(depth_image);
+
+        createModelPipelines();
+
+        if (m_DepthPrePass && nullptr == m_ModelDepthPipeline) {
+            m_ModelDepthPipeline =
+                Vulkan::GraphicsPipelineBuilder()
+                    .setVertexShader("vs_depth", g_ModelShader)
+                    .setVertexLayouts({Vulkan::VertexLayout{
+                        vk::VertexInputBindingDescription{0, sizeof(Vertex), vk::VertexInputRate::eVertex},
+                        {
+                            vk::VertexInputAttributeDescription{0, 0, vk::Format::eR32G32B32Sfloat, offsetof(Vertex, Position)},
+                        },
+                    }})
+                    .setInputTopology(vk::PrimitiveTopology::eTriangleList)
+                    .setPolygonMode(vk::PolygonMode::eFill)
+                    .setCullMode(vk::CullModeFlagBits::eBack, vk::FrontFace::eCounterClockwise)
+                    .setDepthAttachmentFormat(m_ModelDepthFormat)
+                    .setDepthTest(vk::True, vk::CompareOp::eLess)
+                    .setNoStencilTest()
+                    .setNoMultisampling()
+                    .setNoBlending()
+                    .build(m_ModelPipelineLayout);
+        }
+    }
+
+    void Render::createModelPipelines() {
+        if (vk::Format::eUndefined == m_ModelColorFormat)
+            return;
+
+        // One pipeline per material feature set in use, the fragment shader compiles out the missing maps.
+        for (const MaterialDrawRange &range : m_MaterialDrawRanges) {
+            if (m_ModelPipelines.contains(range.Features))
+                continue;
+
+            const vk::Pipeline pipeline =
                 Vulkan::GraphicsPipelineBuilder()
                     .setVertexShader("vs_main", g_ModelShader)
                     .setFragmentShader("fs_main", g_ModelShader)
+                    .setSpecializationConstant(vk::ShaderStageFlagBits::eFragment, 0, range.Features)
                     .setVertexLayouts({Vulkan::VertexLayout{
                         vk::VertexInputBindingDescription{0, sizeof(Vertex), vk::VertexInputRate::eVertex},
                         {
@@ -134,34 +215,96 @@ namespace Ignis {
                     .setInputTopology(vk::PrimitiveTopology::eTriangleList)
                     .setPolygonMode(vk::PolygonMode::eFill)
                     .setCullMode(vk::CullModeFlagBits::eBack, vk::FrontFace::eCounterClockwise)
-                    .setColorAttachmentFormats({m_pFrameGraph->getImageFormat(color_image)})
-                    .setDepthAttachmentFormat(m_pFrameGraph->getImageFormat(depth_image))
-                    .setDepthTest(vk::True, vk::CompareOp::eLess)
+                    .setColorAttachmentFormats({m_ModelColorFormat})
+                    .setDepthAttachmentFormat(m_ModelDepthFormat)
+                    .setDepthTest(
+                        m_DepthPrePass ? vk::False : vk::True,
+                        m_DepthPrePass ? vk::CompareOp::eEqual : vk::CompareOp::eLess)
                     .setNoStencilTest()
                     .setNoMultisampling()
                     .setNoBlending()
                     .build(m_ModelPipelineLayout);
+
+            m_ModelPipelines.emplace(range.Features, pipeline);
         }
     }
 
     void Render::readModelBuffers(FrameGraph::RenderPass &render_pass) {
         render_pass
-            .readBuffers(m_FrameGraphModelVertexBuffers.getData())
-            .readBuffers(m_FrameGraphModelIndexBuffers.getData())
             .readBuffers(m_FrameGraphModelMeshBuffers.getData())
-            .readBuffers(m_FrameGraphModelInstanceBuffers.getData())
-            .readBuffers(m_FrameGraphModelIndirectBuffers.getData());
+            .readBuffers(m_FrameGraphModelInstancePageTables.getData());
+
+        readGeometryBuffers(render_pass);
+        readDrawBuffers(render_pass);
+        readPagePool(m_InstancePages, render_pass);
     }
 
-    void Render::onModelDraw(const vk::CommandBuffer command_buffer) {
+    void Render::recordModelDepthPass(FrameGraph &frame_graph, const vk::AttachmentLoadOp load_op) {
+        FrameGraph::RenderPass model_depth_render_pass{
+            "Ignis::Render::Model Depth Pass",
+            {0.5f, 0.0f, 0.0f, 1.0f},
+        };
+
+        model_depth_render_pass
+            .setDepthAttachment(FrameGraph::Attachment{
+                m_DepthImage,
+                vk::ClearDepthStencilValue{1.0f},
+                load_op,
+                vk::AttachmentStoreOp::eStore,
+            })
+            .setExecute([this](const vk::CommandBuffer command_buffer) {
+                onModelDepthDraw(command_buffer);
+            });
+
+        readModelBuffers(model_depth_render_pass);
+
+        frame_graph.addRenderPass(model_depth_render_pass);
+    }
+
+    void Render::recordModelPass(FrameGraph &frame_graph, const vk::AttachmentLoadOp load_op) {
+        // The pre-pass owns the depth attachment, the shading pass only tests against it.
+        if (m_DepthPrePass)
+            recordModelDepthPass(frame_graph, load_op);
+
+        FrameGraph::RenderPass model_render_pass{
+            "Ignis::Render::Model Pass",
+            {1.0f, 0.0f, 0.0f, 1.0f},
+        };
+
+        model_render_pass
+            .setColorAttachments(FrameGraph::Attachment{
+                m_ColorImage,
+                vk::ClearColorValue{0.0f, 0.0f, 0.0f, 1.0f},
+                load_op,
+                vk::AttachmentStoreOp::eStore,
+            })
+            .setDepthAttachment(FrameGraph::Attachment{
+                m_DepthImage,
+                vk::ClearDepthStencilValue{1.0f},
+                m_DepthPrePass ? vk::AttachmentLoadOp::eLoad : load_op,
+                vk::AttachmentStoreOp::eStore,
+            })
+            .setExecute([this](const vk::CommandBuffer command_buffer) {
+                onModelDraw(command_buffer);
+            });
+
+        readMaterialImages(model_render_pass);
+        readMaterialBuffers(model_render_pass);
+        readLightBuffers(model_render_pass);
+        readModelBuffers(model_render_pass);
+
+        frame_graph.addRenderPass(model_render_pass);
+    }
+
+    void Render::onModelDepthDraw(const vk::CommandBuffer command_buffer) {
         const DrawPC draw_pc{
             m_Camera.Projection * m_Camera.View,
             m_Camera.Position,
             static_cast<glm::f32>(m_PrefilterImage.MipLevelCount - 1),
-            k_InvalidModelID,
+            0,
         };
 
-        command_buffer.bindPipeline(vk::PipelineBindPoint::eGraphics, m_ModelPipeline);
+        command_buffer.bindPipeline(vk::PipelineBindPoint::eGraphics, m_ModelDepthPipeline);
         command_buffer.bindDescriptorSets(
             vk::PipelineBindPoint::eGraphics,
             m_ModelPipelineLayout, 0,
@@ -174,37 +317,75 @@ namespace Ignis {
             sizeof(DrawPC),
             &draw_pc);
 
-        for (const auto &[model_id, model] : m_Models) {
+        command_buffer.bindIndexBuffer(m_IndexBuffer.Handle, 0, vk::IndexType::eUint32);
+        command_buffer.bindVertexBuffers(0, {m_VertexBuffer.Handle}, {0});
+
+        command_buffer.drawIndexedIndirectCount(
+            m_CulledDrawCommandBuffer.Handle, 0,
+            m_DrawCountBuffer.Handle, 0,
+            m_DrawCapacity,
+            sizeof(vk::DrawIndexedIndirectCommand));
+    }
+
+    void Render::onModelDraw(const vk::CommandBuffer command_buffer) {
+        DrawPC draw_pc{
+            m_Camera.Projection * m_Camera.View,
+            m_Camera.Position,
+            static_cast<glm::f32>(m_PrefilterImage.MipLevelCount - 1),
+            0,
+            getTextureFeedbackBase(),
+        };
+
+        command_buffer.bindDescriptorSets(
+            vk::PipelineBindPoint::eGraphics,
+            m_ModelPipelineLayout, 0,
+            {m_MaterialDescriptorSet, m_LightDescriptorSet, m_ModelDescriptorSet}, {});
+
+        command_buffer.bindIndexBuffer(m_IndexBuffer.Handle, 0, vk::IndexType::eUint32);
+        command_buffer.bindVertexBuffers(0, {m_VertexBuffer.Handle}, {0});
+
+        // Draws are grouped by material features, so every permutation is one indirect call.
+        for (const MaterialDrawRange &range : m_MaterialDrawRanges) {
+            draw_pc.DrawBase = range.FirstDraw;
+
+            command_buffer.bindPipeline(vk::PipelineBindPoint::eGraphics, m_ModelPipelines.at(range.Features));
             command_buffer.pushConstants(
                 m_ModelPipelineLayout,
                 vk::ShaderStageFlagBits::eVertex | vk::ShaderStageFlagBits::eFragment,
-                offsetof(DrawPC, Model),
-                sizeof(ModelID),
-                &model_id);
-            command_buffer.bindIndexBuffer(model.IndexBuffer.Handle, 0, vk::IndexType::eUint32);
-            command_buffer.bindVertexBuffers(0, {model.VertexBuffer.Handle}, {0});
+                0,
+                sizeof(DrawPC),
+                &draw_pc);
+
             command_buffer.drawIndexedIndirect(
-                model.IndirectBuffer.Handle, 0,
-                model.MeshCount,
+                m_CulledDrawCommandBuffer.Handle,
+                sizeof(vk::DrawIndexedIndirectCommand) * range.FirstDraw,
+                range.DrawCount,
                 sizeof(vk::DrawIndexedIndirectCommand));
         }
     }
 
-    void Render::setInstance(const InstanceID id, const glm::mat4x4 &transform) {
-        DIGNIS_ASSERT(m_Instances.contains(id));
-        const auto  model_id = m_InstanceToModel.at(id);
-        const auto &model    = m_Models.at(model_id);
-        const auto  index    = model.InstanceToIndex.at(id);
+    void Render::setInstances(const std::span<const InstanceID> ids, const std::span<const glm::mat4x4> transforms) {
+        DIGNIS_ASSERT(ids.size() == transforms.size());
+
+        gtl::flat_hash_map<ModelID, std::pair<uint32_t, uint32_t>> dirty_ranges{};
 
-        Instance instance{};
-        instance.VertexTransform = transform;
-        instance.NormalTransform = glm::transpose(glm::inverse(transform));
+        for (uint32_t i = 0; i < ids.size(); i++) {
+            DIGNIS_ASSERT(m_Instances.contains(ids[i]));
+            const auto model_id = m_InstanceToModel.at(ids[i]);
+            auto      &model    = m_Models.at(model_id);
+            const auto index    = model.InstanceToIndex.at(ids[i]);
 
-        Vulkan::CopyMemoryToAllocation(
-            &instance,
-            model.InstanceBuffer.Allocation,
-            sizeof(Instance) * index,
-            sizeof(Instance));
+            model.Instances[index] = Instance{transforms[i], GetNormalTransform(transforms[i])};
+
+            const auto [it, inserted] = dirty_ranges.try_emplace(model_id, index, index + 1);
+            if (!inserted) {
+                it->second.first  = glm::min(it->second.first, index);
+                it->second.second = glm::max(it->second.second, index + 1);
+            }
+        }
+
+        for (const auto &[model_id, range] : dirty_ranges)
+            uploadInstances(model_id, range.first, range.second);
     }
 
     Render::ModelID Render::addModel(const std::filesystem::path &path) {
@@ -213,48 +394,63 @@ namespace Ignis {
         if (m_LoadedModels.contains(spath))
             return m_LoadedModels.at(spath);
 
-        DIGNIS_ASSERT(std::filesystem::exists(path));
-
-        Assimp::Importer importer{};
-
         Vulkan::WaitDeviceIdle();
 
-        const aiScene *ai_scene =
-            importer.ReadFile(
-                spath,
-                // aiProcess_CalcTangentSpace |
-                aiProcess_Triangulate |
-                    aiProcess_GenNormals |
-                    aiProcess_GenUVCoords |
-                    aiProcess_OptimizeMeshes |
-                    aiProcess_OptimizeGraph |
-                    aiProcess_JoinIdenticalVertices |
-                    aiProcess_FixInfacingNormals |
-                    aiProcess_RemoveRedundantMaterials |
-                    aiProcess_FindDegenerates |
-                    aiProcess_FindInvalidData |
-                    aiProcess_ImproveCacheLocality |
-                    aiProcess_ValidateDataStructure |
-                    aiProcess_FlipUVs);
-        if (nullptr == ai_scene) {
-            DIGNIS_LOG_ENGINE_WARN("Failed to load asset from path: '{}'. Assimp error: '{}'", spath, importer.GetErrorString());
+        std::optional<CookedModel> cooked_model_opt = loadModel(path);
+        if (!cooked_model_opt.has_value())
             return k_InvalidModelID;
-        }
-        DIGNIS_LOG_ENGINE_INFO("Loaded an Ignis::AssimpAsset from path: '{}'", spath);
 
-        const aiNode *ai_node = ai_scene->mRootNode;
+        const CookedModel &cooked_model = cooked_model_opt.value();
 
-        std::vector<Vertex>   vertices{};
-        std::vector<uint32_t> indices{};
-        std::vector<Mesh>     meshes{};
+        std::vector<Mesh> meshes = cooked_model.Meshes;
 
-        std::vector<vk::DrawIndexedIndirectCommand> indirect_commands{};
+        std::vector<vk::DrawIndexedIndirectCommand> indirect_commands = cooked_model.IndirectCommands;
 
-        Vulkan::WaitDeviceIdle();
+        // Every texture the materials use is imported once per role, however many materials share it.
+        std::vector<PreparedTexture> prepared_textures{};
+        {
+            gtl::flat_hash_set<uint32_t> material_indices{};
+            gtl::flat_hash_set<uint64_t> import_keys{};
+            for (const Mesh &mesh : meshes) {
+                if (!material_indices.insert(mesh.Material.ID).second)
+                    continue;
+
+                const CookedMaterial &cooked_material = cooked_model.Materials[mesh.Material.ID];
+                for (uint32_t i = 0; i < k_TextureRoleCount; i++) {
+                    const uint32_t    texture_index = cooked_material.Textures[i];
+                    const TextureRole role          = static_cast<TextureRole>(i);
+                    if (k_InvalidCookedTexture == texture_index || !import_keys.insert(GetTextureImportKey(texture_index, role)).second)
+                        continue;
+
+                    PreparedTexture &texture = prepared_textures.emplace_back();
+                    texture.TextureIndex     = texture_index;
+                    texture.Role             = role;
+                }
+            }
+        }
+
+        // Every texture is read, decoded and encoded by its own job, so one waiting on its file leaves the cores to the
+        // others. Staging memory is written in place, only the uploads and registration are left to this thread.
+        const std::filesystem::path directory = path.parent_path();
+
+        std::for_each(
+            std::execution::par,
+            std::begin(prepared_textures), std::end(prepared_textures),
+            [&](PreparedTexture &texture) {
+                prepareTexture(directory, cooked_model, texture);
+            });
 
-        processNode(path, ai_scene, ai_node, glm::mat4x4{1.0f}, vertices, indices, meshes, indirect_commands);
+        gtl::flat_hash_map<uint64_t, TextureID> texture_ids{};
+        for (PreparedTexture &texture : prepared_textures)
+            texture_ids.emplace(GetTextureImportKey(texture.TextureIndex, texture.Role), uploadTexture(texture));
 
-        DIGNIS_ASSERT(meshes.size() == indirect_commands.size());
+        for (Mesh &mesh : meshes)
+            mesh.Material = processMaterial(path, cooked_model, mesh.Material.ID, texture_ids);
+
+        // The materials hold their own references now, the import drops the one it took.
+        for (const TextureID texture_id : texture_ids | std::views::values)
+            if (k_InvalidTextureID != texture_id)
+                removeTextureRC(texture_id);
 
         Model model{};
 
@@ -264,19 +460,16 @@ namespace Ignis {
 
         model.InstanceCount = 0;
 
-        model.VertexBuffer = Vulkan::AllocateBuffer(
-            {}, vma::MemoryUsage::eGpuOnly, {},
-            sizeof(Vertex) * vertices.size(),
-            vk::BufferUsageFlagBits::eVertexBuffer |
-                vk::BufferUsageFlagBits::eTransferSrc |
-                vk::BufferUsageFlagBits::eTransferDst);
+        model.BoundsMin      = cooked_model.BoundsMin;
+        model.BoundsMax      = cooked_model.BoundsMax;
+        model.BoundingSphere = cooked_model.BoundingSphere;
 
-        model.IndexBuffer = Vulkan::AllocateBuffer(
-            {}, vma::MemoryUsage::eGpuOnly, {},
-            sizeof(uint32_t) * indices.size(),
-            vk::BufferUsageFlagBits::eIndexBuffer |
-                vk::BufferUsageFlagBits::eTransferSrc |
-                vk::BufferUsageFlagBits::eTransferDst);
+        allocateGeometry(model, cooked_model.VertexCount, cooked_model.IndexCount);
+
+        for (auto &indirect_command : indirect_commands) {
+            indirect_command.firstIndex += model.IndexAllocation.Offset;
+            indirect_command.vertexOffset += static_cast<int32_t>(model.VertexAllocation.Offset);
+        }
 
         model.MeshBuffer = Vulkan::AllocateBuffer(
             {}, vma::MemoryUsage::eGpuOnly, {},
@@ -286,39 +479,47 @@ namespace Ignis {
                 vk::BufferUsageFlagBits::eTransferDst);
 
         {
+            const uint64_t vertices_size = cooked_model.VertexData.size();
+            const uint64_t indices_size  = cooked_model.IndexData.size();
+
             const Vulkan::Buffer staging_buffer = Vulkan::AllocateBuffer(
                 vma::AllocationCreateFlagBits::eMapped,
                 vma::MemoryUsage::eCpuOnly, {},
-                model.VertexBuffer.Size + model.IndexBuffer.Size + model.MeshBuffer.Size,
+                vertices_size + indices_size + model.MeshBuffer.Size,
                 vk::BufferUsageFlagBits::eTransferSrc);
 
+            // Cooked geometry is already in its GPU layout, it goes from the file straight into staging.
             {
                 uint64_t offset = 0;
-                Vulkan::CopyMemoryToAllocation(vertices.data(), staging_buffer.Allocation, offset, model.VertexBuffer.Size);
-                offset += model.VertexBuffer.Size;
-                Vulkan::CopyMemoryToAllocation(indices.data(), staging_buffer.Allocation, offset, model.IndexBuffer.Size);
-                offset += model.IndexBuffer.Size;
+                Vulkan::CopyMemoryToAllocation(cooked_model.VertexData.data(), staging_buffer.Allocation, offset, vertices_size);
+                offset += vertices_size;
+                Vulkan::CopyMemoryToAllocation(cooked_model.IndexData.data(), staging_buffer.Allocation, offset, indices_size);
+                offset += indices_size;
                 Vulkan::CopyMemoryToAllocation(meshes.data(), staging_buffer.Allocation, offset, model.MeshBuffer.Size);
                 offset += model.MeshBuffer.Size;
             }
 
             Vulkan::ImmediateSubmit([&](const vk::CommandBuffer command_buffer) {
                 uint64_t offset = 0;
-                Vulkan::CopyBufferToBuffer(
-                    staging_buffer.Handle,
-                    model.VertexBuffer.Handle,
-                    offset, 0,
-                    model.VertexBuffer.Size,
-                    command_buffer);
-                offset += model.VertexBuffer.Size;
-
-                Vulkan::CopyBufferToBuffer(
-                    staging_buffer.Handle,
-                    model.IndexBuffer.Handle,
-                    offset, 0,
-                    model.IndexBuffer.Size,
-                    command_buffer);
-                offset += model.IndexBuffer.Size;
+                if (0 != vertices_size) {
+                    Vulkan::CopyBufferToBuffer(
+                        staging_buffer.Handle,
+                        m_VertexBuffer.Handle,
+                        offset, sizeof(Vertex) * model.VertexAllocation.Offset,
+                        vertices_size,
+                        command_buffer);
+                }
+                offset += vertices_size;
+
+                if (0 != indices_size) {
+                    Vulkan::CopyBufferToBuffer(
+                        staging_buffer.Handle,
+                        m_IndexBuffer.Handle,
+                        offset, sizeof(uint32_t) * model.IndexAllocation.Offset,
+                        indices_size,
+                        command_buffer);
+                }
+                offset += indices_size;
 
                 Vulkan::CopyBufferToBuffer(
                     staging_buffer.Handle,
@@ -332,26 +533,14 @@ namespace Ignis {
             Vulkan::DestroyBuffer(staging_buffer);
         }
 
-        model.InstanceBuffer = Vulkan::AllocateBuffer(
-            vma::AllocationCreateFlagBits::eMapped |
-                vma::AllocationCreateFlagBits::eHostAccessRandom,
-            vma::MemoryUsage::eCpuOnly, {},
-            sizeof(Instance) * 2,
+        model.InstancePageTable = allocateUploadBuffer(
+            m_InstanceUploadStrategy,
+            sizeof(uint32_t) * k_MaxInstancePagesPerModel,
             vk::BufferUsageFlagBits::eStorageBuffer |
-                vk::BufferUsageFlagBits::eTransferSrc |
-                vk::BufferUsageFlagBits::eTransferDst);
-
-        model.IndirectBuffer = Vulkan::AllocateBuffer(
-            vma::AllocationCreateFlagBits::eMapped |
-                vma::AllocationCreateFlagBits::eHostAccessRandom,
-            vma::MemoryUsage::eCpuOnly, {},
-            sizeof(vk::DrawIndexedIndirectCommand) * model.MeshCount,
-            vk::BufferUsageFlagBits::eIndirectBuffer |
-                vk::BufferUsageFlagBits::eStorageBuffer |
-                vk::BufferUsageFlagBits::eTransferSrc |
-                vk::BufferUsageFlagBits::eTransferDst);
+                vk::BufferUsageFlagBits::eTransferSrc);
 
-        Vulkan::CopyMemoryToAllocation(indirect_commands.data(), model.IndirectBuffer.Allocation, 0, model.IndirectBuffer.Size);
+        model.Meshes           = std::move(meshes);
+        model.IndirectCommands = std::move(indirect_commands);
 
         ModelID id{};
         if (m_FreeModelIDs.empty()) {
@@ -362,27 +551,29 @@ namespace Ignis {
             m_FreeModelIDs.pop_back();
         }
 
-        m_Models.emplace(id, model);
+        for (uint32_t i = 0; i < model.MeshCount; i++) {
+            MeshID mesh_id{};
+            if (m_FreeMeshIDs.empty()) {
+                mesh_id = m_NextMeshID;
+                m_NextMeshID.ID++;
+            } else {
+                mesh_id = m_FreeMeshIDs.back();
+                m_FreeMeshIDs.pop_back();
+            }
 
-        m_LoadedModels.emplace(spath, id);
+            model.MeshToIndex.emplace(mesh_id, i);
+            model.IndexToMesh.emplace(i, mesh_id);
 
-        m_FrameGraphModelIndexBuffers.insert(
-            id,
-            FrameGraph::BufferInfo{
-                m_pFrameGraph->importBuffer(model.IndexBuffer.Handle, model.IndexBuffer.Usage, 0, model.IndexBuffer.Size),
-                0,
-                model.IndexBuffer.Size,
-                vk::PipelineStageFlagBits2::eIndexInput,
-            });
+            m_Meshes.insert(mesh_id);
+            m_MeshToModel.emplace(mesh_id, id);
+        }
 
-        m_FrameGraphModelVertexBuffers.insert(
-            id,
-            FrameGraph::BufferInfo{
-                m_pFrameGraph->importBuffer(model.VertexBuffer.Handle, model.VertexBuffer.Usage, 0, model.VertexBuffer.Size),
-                0,
-                model.VertexBuffer.Size,
-                vk::PipelineStageFlagBits2::eVertexInput,
-            });
+        model.InstanceToIndex.clear();
+        model.IndexToInstance.clear();
+
+        m_Models.emplace(id, model);
+
+        m_LoadedModels.emplace(spath, id);
 
         m_FrameGraphModelMeshBuffers.insert(
             id,
@@ -393,129 +584,80 @@ namespace Ignis {
                 vk::PipelineStageFlagBits2::eVertexShader,
             });
 
-        m_FrameGraphModelInstanceBuffers.insert(
+        m_FrameGraphModelInstancePageTables.insert(
             id,
             FrameGraph::BufferInfo{
-                m_pFrameGraph->importBuffer(model.InstanceBuffer.Handle, model.InstanceBuffer.Usage, 0, model.InstanceBuffer.Size),
+                m_pFrameGraph->importBuffer(model.InstancePageTable.Handle, model.InstancePageTable.Usage, 0, model.InstancePageTable.Size),
                 0,
-                model.InstanceBuffer.Size,
+                model.InstancePageTable.Size,
                 vk::PipelineStageFlagBits2::eVertexShader,
             });
 
-        m_FrameGraphModelIndirectBuffers.insert(
-            id,
-            FrameGraph::BufferInfo{
-                m_pFrameGraph->importBuffer(model.IndirectBuffer.Handle, model.IndirectBuffer.Usage, 0, model.IndirectBuffer.Size),
-                0,
-                model.IndirectBuffer.Size,
-                vk::PipelineStageFlagBits2::eDrawIndirect,
-            });
-
-        for (uint32_t i = 0; i < model.MeshCount; i++) {
-            MeshID mesh_id{};
-            if (m_FreeMeshIDs.empty()) {
-                mesh_id = m_NextMeshID;
-                m_NextMeshID.ID++;
-            } else {
-                mesh_id = m_FreeMeshIDs.back();
-                m_FreeMeshIDs.pop_back();
-            }
-
-            model.MeshToIndex.emplace(mesh_id, i);
-            model.IndexToMesh.emplace(i, mesh_id);
-        }
-
-        model.InstanceToIndex.clear();
-        model.IndexToInstance.clear();
+        rebuildDraws();
 
         Vulkan::DescriptorSetWriter()
             .writeStorageBuffer(0, id.ID, model.MeshBuffer.Handle, 0, model.MeshBuffer.Size)
-            .writeStorageBuffer(1, id.ID, model.InstanceBuffer.Handle, 0, model.InstanceBuffer.Size)
+            .writeStorageBuffer(2, id.ID, model.InstancePageTable.Handle, 0, model.InstancePageTable.Size)
             .update(m_ModelDescriptorSet);
 
         return id;
     }
 
-    Render::InstanceID Render::addInstance(const ModelID model_id, const glm::mat4x4 &transform) {
+    std::vector<Render::InstanceID> Render::addInstances(const ModelID model_id, const std::span<const glm::mat4x4> transforms) {
         DIGNIS_ASSERT(m_Models.contains(model_id));
 
-        Model &model = m_Models.at(model_id);
-
-        Vulkan::WaitDeviceIdle();
-
-        Instance instance{};
-        instance.VertexTransform = transform;
-        instance.NormalTransform = GetNormalTransform(transform);
+        std::vector<InstanceID> ids{};
+        ids.reserve(transforms.size());
 
-        InstanceID id{};
+        if (transforms.empty())
+            return ids;
 
-        if (m_FreeInstanceIDs.empty()) {
-            id = m_NextInstanceID;
-            m_NextInstanceID.ID++;
-        } else {
-            id = m_FreeInstanceIDs.back();
-            m_FreeInstanceIDs.pop_back();
-        }
+        reserveInstances(model_id, m_Models.at(model_id).InstanceCount + transforms.size());
 
-        const uint32_t index = model.InstanceCount++;
+        Model &model = m_Models.at(model_id);
 
-        if (sizeof(Instance) * index >= model.InstanceBuffer.Size) {
-            m_pFrameGraph->removeBuffer(m_FrameGraphModelInstanceBuffers[model_id].Buffer);
+        const uint32_t first_index = model.InstanceCount;
 
-            const Vulkan::Buffer old_buffer = model.InstanceBuffer;
+        model.Instances.resize(first_index + transforms.size());
 
-            model.InstanceBuffer = Vulkan::AllocateBuffer(
-                old_buffer.AllocationFlags,
-                old_buffer.MemoryUsage,
-                old_buffer.CreateFlags,
-                old_buffer.Size * 2,
-                old_buffer.Usage);
+        std::transform(
+            std::execution::par_unseq,
+            std::begin(transforms), std::end(transforms),
+            std::begin(model.Instances) + first_index,
+            [](const glm::mat4x4 &transform) {
+                return Instance{transform, GetNormalTransform(transform)};
+            });
 
-            m_FrameGraphModelInstanceBuffers[model_id] = FrameGraph::BufferInfo{
-                m_pFrameGraph->importBuffer(model.InstanceBuffer.Handle, model.InstanceBuffer.Usage, 0, model.InstanceBuffer.Size),
-                0,
-                model.InstanceBuffer.Size,
-                vk::PipelineStageFlagBits2::eVertexShader,
-            };
+        uploadInstances(model_id, first_index, first_index + transforms.size());
 
-            Vulkan::InvalidateAllocation(old_buffer.Allocation, 0, old_buffer.Size);
-            Vulkan::CopyMemoryToAllocation(
-                Vulkan::GetAllocationInfo(old_buffer).pMappedData,
-                model.InstanceBuffer.Allocation, 0,
-                old_buffer.Size);
+        for (uint32_t i = 0; i < transforms.size(); i++) {
+            InstanceID id{};
 
-            Vulkan::DestroyBuffer(old_buffer);
+            if (m_FreeInstanceIDs.empty()) {
+                id = m_NextInstanceID;
+                m_NextInstanceID.ID++;
+            } else {
+                id = m_FreeInstanceIDs.back();
+                m_FreeInstanceIDs.pop_back();
+            }
 
-            Vulkan::DescriptorSetWriter()
-                .writeStorageBuffer(1, model_id.ID, model.InstanceBuffer.Handle, 0, model.InstanceBuffer.Size)
-                .update(m_ModelDescriptorSet);
-        }
+            const uint32_t index = first_index + i;
 
-        Vulkan::CopyMemoryToAllocation(
-            &instance,
-            model.InstanceBuffer.Allocation,
-            sizeof(Instance) * index,
-            sizeof(Instance));
+            m_Instances.insert(id);
 
-        m_Instances.insert(id);
+            model.InstanceToIndex.emplace(id, index);
+            model.IndexToInstance.emplace(index, id);
 
-        model.InstanceToIndex.emplace(id, index);
-        model.IndexToInstance.emplace(index, id);
+            m_InstanceToModel.emplace(id, model_id);
 
-        m_InstanceToModel.emplace(id, model_id);
+            ids.push_back(id);
+        }
 
-        {
-            Vulkan::InvalidateAllocation(model.IndirectBuffer.Allocation, 0, model.IndirectBuffer.Size);
-            const auto info = Vulkan::GetAllocationInfo(model.IndirectBuffer);
+        model.InstanceCount += transforms.size();
 
-            auto *indirect_commands = static_cast<vk::DrawIndexedIndirectCommand *>(info.pMappedData);
-            for (uint32_t i = 0; i < model.MeshCount; i++) {
-                indirect_commands[i].instanceCount++;
-            }
-            Vulkan::FlushAllocation(model.IndirectBuffer.Allocation, 0, model.IndirectBuffer.Size);
-        }
+        updateIndirectInstanceCounts(model_id);
 
-        return id;
+        return ids;
     }
 
     void Render::removeModel(const ModelID id) {
@@ -527,239 +669,215 @@ namespace Ignis {
 
         Vulkan::DescriptorSetWriter()
             .writeStorageBuffer(0, id.ID, nullptr, 0, vk::WholeSize)
-            .writeStorageBuffer(1, id.ID, nullptr, 0, vk::WholeSize)
+            .writeStorageBuffer(2, id.ID, nullptr, 0, vk::WholeSize)
             .update(m_ModelDescriptorSet);
 
         for (const auto &instance : std::views::values(model.IndexToInstance))
             m_InstanceToModel.erase(instance);
 
-        const Vulkan::Buffer mesh_buffer = Vulkan::AllocateBuffer(
-            vma::AllocationCreateFlagBits::eMapped |
-                vma::AllocationCreateFlagBits::eHostAccessRandom,
-            vma::MemoryUsage::eCpuOnly, {},
-            model.MeshBuffer.Size,
-            vk::BufferUsageFlagBits::eTransferDst);
-        Vulkan::ImmediateSubmit([&](const vk::CommandBuffer command_buffer) {
-            Vulkan::CopyBufferToBuffer(
-                model.MeshBuffer.Handle,
-                mesh_buffer.Handle,
-                0, 0,
-                mesh_buffer.Size,
-                command_buffer);
-        });
-        Vulkan::InvalidateAllocation(mesh_buffer.Allocation, 0, mesh_buffer.Size);
+        for (const auto &mesh : model.Meshes)
+            removeMaterialRC(mesh.Material);
 
-        const auto *meshes = static_cast<Mesh *>(Vulkan::GetAllocationInfo(mesh_buffer).pMappedData);
+        for (const auto &mesh_id : std::views::values(model.IndexToMesh)) {
+            m_Meshes.erase(mesh_id);
+            m_MeshToModel.erase(mesh_id);
 
-        for (uint32_t i = 0; i < model.MeshCount; i++)
-            removeMaterialRC(meshes[i].Material);
-
-        Vulkan::DestroyBuffer(mesh_buffer);
+            m_FreeMeshIDs.push_back(mesh_id);
+        }
 
-        m_pFrameGraph->removeBuffer(m_FrameGraphModelIndexBuffers[id].Buffer);
-        m_pFrameGraph->removeBuffer(m_FrameGraphModelVertexBuffers[id].Buffer);
         m_pFrameGraph->removeBuffer(m_FrameGraphModelMeshBuffers[id].Buffer);
-        m_pFrameGraph->removeBuffer(m_FrameGraphModelInstanceBuffers[id].Buffer);
-        m_pFrameGraph->removeBuffer(m_FrameGraphModelIndirectBuffers[id].Buffer);
+        m_pFrameGraph->removeBuffer(m_FrameGraphModelInstancePageTables[id].Buffer);
 
-        m_FrameGraphModelIndexBuffers.remove(id);
-        m_FrameGraphModelVertexBuffers.remove(id);
         m_FrameGraphModelMeshBuffers.remove(id);
-        m_FrameGraphModelInstanceBuffers.remove(id);
-        m_FrameGraphModelIndirectBuffers.remove(id);
+        m_FrameGraphModelInstancePageTables.remove(id);
+
+        for (const uint32_t page : model.InstancePages)
+            freePage(m_InstancePages, page);
+
+        discardUploads(model.InstancePageTable.Handle);
 
-        Vulkan::DestroyBuffer(model.VertexBuffer);
-        Vulkan::DestroyBuffer(model.IndexBuffer);
         Vulkan::DestroyBuffer(model.MeshBuffer);
-        Vulkan::DestroyBuffer(model.InstanceBuffer);
-        Vulkan::DestroyBuffer(model.IndirectBuffer);
+        Vulkan::DestroyBuffer(model.InstancePageTable);
+
+        const GeometryAllocation vertex_allocation = model.VertexAllocation;
+        const GeometryAllocation index_allocation  = model.IndexAllocation;
 
         m_LoadedModels.erase(model.Path);
 
         m_Models.erase(id);
 
         m_FreeModelIDs.emplace_back(id);
+
+        freeGeometry(vertex_allocation, index_allocation);
+
+        rebuildDraws();
     }
 
-    void Render::removeInstance(const InstanceID id) {
-        DIGNIS_ASSERT(m_Instances.contains(id));
+    void Render::removeInstances(const std::span<const InstanceID> ids) {
+        gtl::flat_hash_map<ModelID, uint32_t> first_dirty_indices{};
 
-        Vulkan::WaitDeviceIdle();
+        for (const auto &id : ids) {
+            DIGNIS_ASSERT(m_Instances.contains(id));
 
-        const auto model_id = m_InstanceToModel.at(id);
+            const auto model_id = m_InstanceToModel.at(id);
 
-        auto &model = m_Models.at(model_id);
+            auto &model = m_Models.at(model_id);
 
-        const uint32_t last_index = --model.InstanceCount;
-        if (const uint32_t index = model.InstanceToIndex.at(id);
-            index != last_index) {
-            Vulkan::InvalidateAllocation(model.InstanceBuffer.Allocation, 0, model.InstanceBuffer.Size);
-            const vma::AllocationInfo allocation_info = Vulkan::GetAllocationInfo(model.InstanceBuffer);
-            Vulkan::CopyMemoryToAllocation(
-                &static_cast<Instance *>(allocation_info.pMappedData)[last_index],
-                model.InstanceBuffer.Allocation,
-                sizeof(Instance) * index,
-                sizeof(Instance));
+            const uint32_t index      = model.InstanceToIndex.at(id);
+            const uint32_t last_index = --model.InstanceCount;
+            if (index != last_index) {
+                model.Instances[index] = model.Instances[last_index];
 
-            const InstanceID last_id = model.IndexToInstance[last_index];
+                const InstanceID last_id = model.IndexToInstance[last_index];
 
-            model.InstanceToIndex[last_id] = index;
-            model.IndexToInstance[index]   = last_id;
-        }
+                model.InstanceToIndex[last_id] = index;
+                model.IndexToInstance[index]   = last_id;
+            }
+            model.Instances.pop_back();
 
-        model.InstanceToIndex.erase(id);
-        model.IndexToInstance.erase(last_index);
+            model.InstanceToIndex.erase(id);
+            model.IndexToInstance.erase(last_index);
 
-        m_InstanceToModel.erase(id);
+            m_Instances.erase(id);
+            m_InstanceToModel.erase(id);
 
-        m_FreeInstanceIDs.push_back(id);
+            m_FreeInstanceIDs.push_back(id);
 
-        {
-            Vulkan::InvalidateAllocation(model.IndirectBuffer.Allocation, 0, model.IndirectBuffer.Size);
-            const auto info = Vulkan::GetAllocationInfo(model.IndirectBuffer);
+            const auto [it, inserted] = first_dirty_indices.try_emplace(model_id, index);
+            if (!inserted)
+                it->second = glm::min(it->second, index);
+        }
 
-            auto *indirect_commands = static_cast<vk::DrawIndexedIndirectCommand *>(info.pMappedData);
-            for (uint32_t i = 0; i < model.MeshCount; i++) {
-                indirect_commands[i].instanceCount--;
-            }
-            Vulkan::FlushAllocation(model.IndirectBuffer.Allocation, 0, model.IndirectBuffer.Size);
+        for (const auto &[model_id, first_dirty_index] : first_dirty_indices) {
+            const auto &model = m_Models.at(model_id);
+
+            if (first_dirty_index < model.InstanceCount)
+                uploadInstances(model_id, first_dirty_index, model.InstanceCount);
+
+            trimInstances(model_id);
+            updateIndirectInstanceCounts(model_id);
         }
     }
 
-    std::string_view Render::getModelPath(const ModelID id) {
-        DIGNIS_ASSERT(m_Models.contains(id));
-        return m_Models.at(id).Path;
-    }
+    void Render::reserveInstances(const ModelID model_id, const uint32_t instance_count) {
+        Model &model = m_Models.at(model_id);
 
-    glm::mat4x4 Render::getInstance(const InstanceID id) {
-        DIGNIS_ASSERT(m_Instances.contains(id));
+        const uint32_t page_count = (instance_count + k_InstancesPerPage - 1) / k_InstancesPerPage;
+        DIGNIS_ASSERT(page_count <= k_MaxInstancePagesPerModel, "Ignis::Render::Model exceeds its instance page table.");
 
-        const auto  model_id = m_InstanceToModel.at(id);
-        const auto &model    = m_Models.at(model_id);
-        const auto  index    = model.InstanceToIndex.at(id);
+        if (model.InstancePages.size() >= page_count)
+            return;
 
-        glm::mat4x4 transform{};
-        Vulkan::CopyAllocationToMemory(
-            model.InstanceBuffer.Allocation,
-            sizeof(Instance) * index,
-            &transform,
-            sizeof(glm::mat4x4));
-        return transform;
-    }
+        // Growing only appends pages, so frames in flight keep reading the pages they already have.
+        while (model.InstancePages.size() < page_count) {
+            const uint32_t page  = allocatePage(m_InstancePages);
+            const uint32_t entry = model.InstancePages.size();
 
-    void Render::processNode(
-        const std::filesystem::path &path,
+            model.InstancePages.push_back(page);
 
-        const aiScene     *ai_scene,
-        const aiNode      *ai_node,
-        const glm::mat4x4 &transform,
+            uploadToBuffer(
+                model.InstancePageTable,
+                sizeof(uint32_t) * entry,
+                &model.InstancePages[entry],
+                sizeof(uint32_t));
+        }
 
-        std::vector<Vertex>   &vertices,
-        std::vector<uint32_t> &indices,
-        std::vector<Mesh>     &meshes,
+        rebuildDraws();
+    }
 
-        std::vector<vk::DrawIndexedIndirectCommand> &indirect_commands) {
-        const glm::mat4x4 node_transform = transform * AssimpToGlm(ai_node->mTransformation);
+    void Render::trimInstances(const ModelID model_id) {
+        Model &model = m_Models.at(model_id);
 
-        for (uint32_t i = 0; i < ai_node->mNumMeshes; i++)
-            processMesh(
-                path, ai_scene,
-                ai_scene->mMeshes[ai_node->mMeshes[i]],
-                node_transform,
-                vertices, indices, meshes,
-                indirect_commands);
+        const uint32_t page_count = (model.InstanceCount + k_InstancesPerPage - 1) / k_InstancesPerPage;
 
-        for (uint32_t i = 0; i < ai_node->mNumChildren; i++)
-            processNode(
-                path, ai_scene,
-                ai_node->mChildren[i],
-                node_transform,
-                vertices, indices, meshes,
-                indirect_commands);
-    }
+        if (model.InstancePages.size() <= glm::max(page_count, 1u))
+            return;
 
-    void Render::processMesh(
-        const std::filesystem::path &path,
+        while (model.InstancePages.size() > glm::max(page_count, 1u)) {
+            freePage(m_InstancePages, model.InstancePages.back());
+            model.InstancePages.pop_back();
+        }
 
-        const aiScene     *ai_scene,
-        const aiMesh      *ai_mesh,
-        const glm::mat4x4 &transform,
+        rebuildDraws();
+    }
 
-        std::vector<Vertex>   &vertices,
-        std::vector<uint32_t> &indices,
-        std::vector<Mesh>     &meshes,
+    void Render::uploadInstances(const ModelID model_id, const uint32_t first_index, const uint32_t last_index) {
+        const Model &model = m_Models.at(model_id);
 
-        std::vector<vk::DrawIndexedIndirectCommand> &indirect_commands) {
-        const uint32_t index_offset  = indices.size();
-        const uint32_t vertex_offset = vertices.size();
+        uint32_t index = first_index;
+        while (index < last_index) {
+            const uint32_t slot  = index % k_InstancesPerPage;
+            const uint32_t count = glm::min(k_InstancesPerPage - slot, last_index - index);
 
-        for (uint32_t i = 0; i < ai_mesh->mNumFaces; i++) {
-            const aiFace &face = ai_mesh->mFaces[i];
-            for (uint32_t j = 0; j < face.mNumIndices; j++) {
-                indices.push_back(face.mIndices[j]);
-            }
+            uploadToBuffer(
+                m_InstancePages.Pages[model.InstancePages[index / k_InstancesPerPage]],
+                sizeof(Instance) * slot,
+                &model.Instances[index],
+                sizeof(Instance) * count);
+
+            index += count;
         }
+    }
 
-        for (uint32_t i = 0; i < ai_mesh->mNumVertices; i++) {
-            Vertex vertex{};
+    void Render::updateIndirectInstanceCounts(const ModelID model_id) {
+        Model &model = m_Models.at(model_id);
+
+        for (uint32_t i = 0; i < model.MeshCount; i++) {
+            model.IndirectCommands[i].instanceCount = model.InstanceCount;
 
-            const auto position = AssimpToGlm(ai_mesh->mVertices[i]);
-            const auto normal   = AssimpToGlm(ai_mesh->mNormals[i]);
-            const auto uv       = AssimpToGlm(ai_mesh->mTextureCoords[0][i]);
-            // const auto tangent  = AssimpToGlm(ai_mesh->mTangents[i]);
-            constexpr auto tangent = glm::vec3{0.0f};
+            const uint32_t draw = model.Draws[i];
 
-            vertex.Position = position;
-            vertex.Normal   = normal;
-            vertex.UV       = uv;
-            vertex.Tangent  = glm::vec4{tangent, 0.0f};
+            m_DrawCommands[draw] = model.IndirectCommands[i];
 
-            vertices.push_back(vertex);
+            uploadToBuffer(
+                m_DrawCommandBuffer,
+                sizeof(vk::DrawIndexedIndirectCommand) * draw,
+                &m_DrawCommands[draw],
+                sizeof(vk::DrawIndexedIndirectCommand));
         }
 
-        const uint32_t index_count = indices.size() - index_offset;
+        m_CullDrawOffsetsDirty = true;
+    }
+
+    std::string_view Render::getModelPath(const ModelID id) {
+        DIGNIS_ASSERT(m_Models.contains(id));
+        return m_Models.at(id).Path;
+    }
 
-        SMikkTSpaceMesh s_mikk_tspace_mesh{};
-        s_mikk_tspace_mesh.IndexCount = index_count;
-        s_mikk_tspace_mesh.Indices    = &indices[index_offset];
-        s_mikk_tspace_mesh.Vertices   = &vertices[vertex_offset];
+    const Render::Model &Render::getModel(const ModelID id) {
+        DIGNIS_ASSERT(m_Models.contains(id));
+        return m_Models.at(id);
+    }
 
-        SMikkTSpaceContext s_mikk_tspace_context{};
-        s_mikk_tspace_context.m_pInterface = &g_SMikkTSpaceInterface;
-        s_mikk_tspace_context.m_pUserData  = &s_mikk_tspace_mesh;
+    Render::Mesh Render::getMesh(const MeshID id) {
+        DIGNIS_ASSERT(m_Meshes.contains(id));
 
-        genTangSpaceDefault(&s_mikk_tspace_context);
+        const auto &model = m_Models.at(m_MeshToModel.at(id));
+        const auto  index = model.MeshToIndex.at(id);
 
-        const aiMaterial *ai_material = ai_scene->mMaterials[ai_mesh->mMaterialIndex];
-        DIGNIS_ASSERT(nullptr != ai_material);
-        const MaterialID material_id = processMaterial(path, ai_scene, ai_material, ai_mesh->mMaterialIndex);
+        return model.Meshes[index];
+    }
 
-        Mesh mesh{};
-        mesh.VertexTransform = transform;
-        mesh.NormalTransform = GetNormalTransform(transform);
-        mesh.Material        = material_id;
+    glm::mat4x4 Render::getInstance(const InstanceID id) {
+        DIGNIS_ASSERT(m_Instances.contains(id));
 
-        vk::DrawIndexedIndirectCommand indirect_command{};
-        indirect_command
-            .setFirstIndex(index_offset)
-            .setIndexCount(index_count)
-            .setVertexOffset(static_cast<int32_t>(vertex_offset))
-            .setFirstInstance(0)
-            .setInstanceCount(0);
+        const auto  model_id = m_InstanceToModel.at(id);
+        const auto &model    = m_Models.at(model_id);
+        const auto  index    = model.InstanceToIndex.at(id);
 
-        meshes.emplace_back(mesh);
-        indirect_commands.emplace_back(indirect_command);
+        return model.Instances[index].VertexTransform;
     }
 
     Render::MaterialID Render::processMaterial(
         const std::filesystem::path &path,
+        const CookedModel           &cooked_model,
+
+        const uint32_t material_index,
 
-        const aiScene    *ai_scene,
-        const aiMaterial *ai_material,
+        const gtl::flat_hash_map<uint64_t, TextureID> &texture_ids) {
+        const CookedMaterial &cooked_material = cooked_model.Materials[material_index];
 
-        const uint32_t ai_material_index) {
-        const std::string material_name = ai_material->GetName().C_Str();
-        const std::string material_path = path / material_name / std::to_string(ai_material_index);
+        const std::string material_path = path / cooked_material.Name / std::to_string(cooked_material.Index);
 
         if (m_LoadedMaterials.contains(material_path)) {
             const auto material_id = m_LoadedMaterials.at(material_path);
@@ -767,49 +885,31 @@ namespace Ignis {
             return material_id;
         }
 
-        const std::filesystem::path directory = path.parent_path();
+        // The import holds a reference to every texture it uploaded, each material takes its own.
+        const auto process_texture = [&](const TextureRole role) {
+            const uint32_t texture_index = cooked_material.Textures[static_cast<uint32_t>(role)];
+            if (k_InvalidCookedTexture == texture_index)
+                return k_InvalidTextureID;
 
-        aiVector3D albedo_factor;
-        aiVector3D emissive_factor;
-
-        ai_real metallic_factor;
-        ai_real roughness_factor;
-
-        if (AI_SUCCESS != ai_material->Get(AI_MATKEY_BASE_COLOR, albedo_factor))
-            if (AI_SUCCESS != ai_material->Get(AI_MATKEY_COLOR_DIFFUSE, albedo_factor))
-                albedo_factor = aiVector3D(1.0f, 1.0f, 1.0f);
-        if (AI_SUCCESS != ai_material->Get(AI_MATKEY_COLOR_EMISSIVE, emissive_factor))
-            emissive_factor = aiVector3D(0.0f, 0.0f, 0.0f);
-        if (AI_SUCCESS != ai_material->Get(AI_MATKEY_METALLIC_FACTOR, metallic_factor))
-            metallic_factor = 1.0f;
-        if (AI_SUCCESS != ai_material->Get(AI_MATKEY_ROUGHNESS_FACTOR, roughness_factor))
-            roughness_factor = 1.0f;
-
-        auto albedo_texture = processTexture(directory, ai_scene, ai_material, aiTextureType_BASE_COLOR, true);
-        if (k_InvalidTextureID == albedo_texture) {
-            albedo_texture = processTexture(directory, ai_scene, ai_material, aiTextureType_DIFFUSE, true);
-        }
-        auto normal_texture = processTexture(directory, ai_scene, ai_material, aiTextureType_NORMALS, false);
-        if (k_InvalidTextureID == normal_texture) {
-            normal_texture = processTexture(directory, ai_scene, ai_material, aiTextureType_HEIGHT, false);
-        }
-        const auto emissive_texture = processTexture(directory, ai_scene, ai_material, aiTextureType_EMISSIVE, true);
-        const auto ambient_occlusion_texture =
-            processTexture(directory, ai_scene, ai_material, aiTextureType_AMBIENT_OCCLUSION, false);
-        const auto metallic_roughness_texture =
-            processTexture(directory, ai_scene, ai_material, aiTextureType_GLTF_METALLIC_ROUGHNESS, false);
-        auto metallic_texture  = k_InvalidTextureID;
-        auto roughness_texture = k_InvalidTextureID;
-        if (k_InvalidTextureID == metallic_roughness_texture) {
-            metallic_texture  = processTexture(directory, ai_scene, ai_material, aiTextureType_METALNESS, false);
-            roughness_texture = processTexture(directory, ai_scene, ai_material, aiTextureType_DIFFUSE_ROUGHNESS, false);
-        }
+            const auto texture_id = texture_ids.at(GetTextureImportKey(texture_index, role));
+            if (k_InvalidTextureID != texture_id)
+                m_LoadedTextureRCs.at(texture_id)++;
+            return texture_id;
+        };
+
+        const auto albedo_texture             = process_texture(TextureRole::eAlbedo);
+        const auto normal_texture             = process_texture(TextureRole::eNormal);
+        const auto emissive_texture           = process_texture(TextureRole::eEmissive);
+        const auto ambient_occlusion_texture  = process_texture(TextureRole::eOcclusion);
+        const auto metallic_roughness_texture = process_texture(TextureRole::eMetallicRoughness);
+        const auto metallic_texture           = process_texture(TextureRole::eMetallic);
+        const auto roughness_texture          = process_texture(TextureRole::eRoughness);
 
         Material material{};
-        material.AlbedoFactor    = AssimpToGlm(albedo_factor);
-        material.MetallicFactor  = metallic_factor;
-        material.EmissiveFactor  = AssimpToGlm(emissive_factor);
-        material.RoughnessFactor = roughness_factor;
+        material.AlbedoFactor    = cooked_material.AlbedoFactor;
+        material.MetallicFactor  = cooked_material.MetallicFactor;
+        material.EmissiveFactor  = cooked_material.EmissiveFactor;
+        material.RoughnessFactor = cooked_material.RoughnessFactor;
 
         material.AlbedoTexture           = k_InvalidTextureID == albedo_texture ? addWhiteTexture() : albedo_texture;
         material.NormalTexture           = k_InvalidTextureID == normal_texture ? addNormalTexture() : normal_texture;
@@ -824,6 +924,22 @@ namespace Ignis {
         material.MetallicTexture  = k_InvalidTextureID == metallic_texture ? addWhiteTexture() : metallic_texture;
         material.RoughnessTexture = k_InvalidTextureID == roughness_texture ? addWhiteTexture() : roughness_texture;
 
+        material.Features = 0;
+        if (k_InvalidTextureID != albedo_texture)
+            material.Features |= k_MaterialFeatureAlbedoMap;
+        if (k_InvalidTextureID != normal_texture)
+            material.Features |= k_MaterialFeatureNormalMap;
+        if (k_InvalidTextureID != emissive_texture)
+            material.Features |= k_MaterialFeatureEmissiveMap;
+        if (k_InvalidTextureID != ambient_occlusion_texture)
+            material.Features |= k_MaterialFeatureOcclusionMap;
+        if (k_InvalidTextureID != metallic_roughness_texture)
+            material.Features |= k_MaterialFeatureMetallicRoughnessMap;
+        if (k_InvalidTextureID != metallic_texture)
+            material.Features |= k_MaterialFeatureMetallicMap;
+        if (k_InvalidTextureID != roughness_texture)
+            material.Features |= k_MaterialFeatureRoughnessMap;
+
         const MaterialID id = addMaterial(material);
         m_LoadedMaterials.emplace(material_path, id);
         m_LoadedMaterialPaths.emplace(id, material_path);
@@ -832,55 +948,173 @@ namespace Ignis {
         return id;
     }
 
-    Render::TextureID Render::processTexture(
+    void Render::prepareTexture(
         const std::filesystem::path &directory,
+        const CookedModel           &cooked_model,
 
-        const aiScene    *ai_scene,
-        const aiMaterial *ai_material,
+        PreparedTexture &texture) const {
+        const TextureRole role = texture.Role;
 
-        const aiTextureType ai_texture_type,
+        const CookedTexture &cooked_texture = cooked_model.Textures[texture.TextureIndex];
 
-        const bool is_srgb) {
-        aiString ai_path{};
+        const std::string texture_path = directory / cooked_texture.Path;
 
-        if (AI_SUCCESS != ai_material->GetTexture(ai_texture_type, 0, &ai_path))
-            return k_InvalidTextureID;
+        const std::string &extension = cooked_texture.Extension;
 
-        const std::string texture_path = directory / ai_path.C_Str();
+        const bool is_srgb = IsTextureRoleSRGB(role);
 
-        if (m_LoadedTextures.contains(texture_path)) {
-            const auto texture_id = m_LoadedTextures.at(texture_path);
-            m_LoadedTextureRCs.at(texture_id)++;
-            return texture_id;
+        // A cooked texture already carries the mip chain and block format of its role.
+        std::optional<std::filesystem::path> cooked_texture_path = std::nullopt;
+        if (m_AssetDatabase.has_value() && m_CompressTextures && cooked_texture.EmbeddedData.empty())
+            cooked_texture_path = m_AssetDatabase->findCooked(texture_path, GetTextureVariant(role));
+
+        // Containers are shipped with their final format and mip chain, they are uploaded as they are.
+        const bool is_ktx2      = cooked_texture_path.has_value() || ".ktx2" == extension;
+        const bool is_container = is_ktx2 || ".dds" == extension;
+
+        // Compressed formats cannot be blit targets, so their mip levels are built on the CPU before encoding.
+        const bool is_compressed_on_load = !is_container && m_CompressTextures;
+
+        // A texture left without assets is skipped by uploadTexture, its materials use the default maps instead.
+        const auto skip_texture = [&texture]() {
+            if (texture.StagingBuffer.Handle)
+                Vulkan::DestroyBuffer(texture.StagingBuffer);
+            texture.StagingBuffer = {};
+            texture.Asset         = std::nullopt;
+            texture.File          = std::nullopt;
+        };
+
+        // Textures are keyed by their content, so byte-identical images under other names or embedded in other models
+        // share one image. Cooks are named by the hash of their inputs and role, so their path already is such a key.
+        if (cooked_texture_path.has_value()) {
+            texture.Key = cooked_texture_path->generic_string();
+        } else {
+            texture.File = LoadTextureFile(cooked_model, cooked_texture, texture_path);
+            if (!texture.File.has_value()) {
+                DIGNIS_LOG_ENGINE_WARN("Failed to find a texture, skipping: '{}'", texture_path);
+                return skip_texture();
+            }
+
+            const std::span<const std::byte> bytes = texture.File->getBytes();
+
+            // Uncooked containers are read whole for the hash, the levels streamed in later find their pages cached.
+            // Containers are uploaded as they are, images are encoded for their role or told apart by color space only.
+            const std::string variant =
+                is_container            ? std::string{}
+                : is_compressed_on_load ? GetTextureVariant(role)
+                : is_srgb               ? std::string{"sRGB"}
+                                        : std::string{"UNorm"};
+
+            texture.Key = FormatString("{:016x}#{}", AssetDatabase::HashBytes(bytes.data(), bytes.size()), variant);
         }
 
-        const aiTexture *ai_texture = ai_scene->GetEmbeddedTexture(ai_path.C_Str());
+        // The render thread waits on the import jobs, so the loaded textures hold still while they are read.
+        if (m_LoadedTextures.contains(texture.Key)) {
+            texture.File = std::nullopt;
+            return;
+        }
 
-        const std::optional<TextureAsset> texture_asset_opt =
-            nullptr != ai_texture
-                ? TextureAsset::LoadFromMemory(ai_texture->pcData, ai_texture->mWidth, TextureAsset::Type::eRGBA8u)
-                : TextureAsset::LoadFromPath(texture_path, TextureAsset::Type::eRGBA8u);
-        DIGNIS_ASSERT(texture_asset_opt.has_value());
-        const TextureAsset &texture_asset = texture_asset_opt.value();
+        if (!texture.File.has_value())
+            texture.File = LoadTextureFile(cooked_model, cooked_texture, cooked_texture_path.value_or(texture_path));
+        if (!texture.File.has_value()) {
+            DIGNIS_LOG_ENGINE_WARN("Failed to find a texture, skipping: '{}'", cooked_texture_path.value_or(texture_path).string());
+            return skip_texture();
+        }
 
-        const vk::Format format =
-            is_srgb
-                ? vk::Format::eR8G8B8A8Srgb
-                : vk::Format::eR8G8B8A8Unorm;
+        const std::span<const std::byte> texture_bytes = texture.File->getBytes();
 
-        const Vulkan::Image image = Vulkan::AllocateImage2D(
-            {}, vma::MemoryUsage::eGpuOnly, {},
-            format,
-            vk::ImageUsageFlagBits::eSampled | vk::ImageUsageFlagBits::eTransferDst,
-            vk::Extent2D{texture_asset.getWidth(), texture_asset.getHeight()});
-        const vk::ImageView view = Vulkan::CreateImageColorView2D(image.Handle, image.Format);
-
-        const Vulkan::Buffer staging_buffer = Vulkan::AllocateBuffer(
-            vma::AllocationCreateFlagBits::eMapped,
-            vma::MemoryUsage::eCpuOnly, {},
-            sizeof(uint8_t) * texture_asset.getData().size(),
-            vk::BufferUsageFlagBits::eTransferSrc);
-        Vulkan::CopyMemoryToAllocation(texture_asset.getData().data(), staging_buffer.Allocation, 0, staging_buffer.Size);
+        // Whatever is uploaded is written straight into the mapped staging buffer, by the decoder or by the encoder.
+        const TextureAsset::Allocator allocate_staging = MakeTextureStagingAllocator(texture.StagingBuffer);
+
+        // Only the resident tail of a container is decoded now, the rest streams in from the same mapped file once sampled.
+        if (!is_container) {
+            texture.Asset = TextureAsset::LoadFromMemory(
+                texture_bytes.data(), texture_bytes.size(),
+                TextureAsset::Type::eRGBA8u,
+                is_compressed_on_load ? TextureAsset::Allocator{} : allocate_staging);
+        } else {
+            TextureAsset::MipRange mip_range{};
+            mip_range.MaxExtent = m_TextureStreamingTailExtent;
+
+            texture.Asset =
+                is_ktx2
+                    ? TextureAsset::LoadKTX2FromMemory(texture_bytes.data(), texture_bytes.size(), allocate_staging, mip_range)
+                    : TextureAsset::LoadDDSFromMemory(texture_bytes.data(), texture_bytes.size(), allocate_staging, mip_range);
+        }
+        if (!texture.Asset.has_value()) {
+            DIGNIS_LOG_ENGINE_WARN("Failed to decode a texture, skipping: '{}'", texture_path);
+            return skip_texture();
+        }
+
+        if (!m_SupportsBlockCompression && TextureAsset::IsBlockCompressed(texture.Asset->getType())) {
+            DIGNIS_LOG_ENGINE_WARN("The device cannot sample block compressed textures, skipping: '{}'", texture_path);
+            return skip_texture();
+        }
+
+        texture.Extent = vk::Extent2D{texture.Asset->getWidth(), texture.Asset->getHeight()};
+
+        // The decoded image and its CPU mip chain are dropped once encoded, every job holding one until the uploads
+        // would multiply the peak memory of an import.
+        if (is_compressed_on_load) {
+            texture.CompressedAsset = CompressTexture(texture.Asset.value(), role, allocate_staging);
+            texture.Asset           = std::nullopt;
+        }
+
+        const TextureAsset &upload_asset = texture.CompressedAsset.has_value() ? texture.CompressedAsset.value() : texture.Asset.value();
+
+        texture.IsKTX2       = is_ktx2;
+        texture.HasMipLevels = is_container || texture.CompressedAsset.has_value();
+        texture.Format       = TextureAsset::GetFormat(upload_asset.getType(), is_container ? upload_asset.isSRGB() : is_srgb);
+
+        Vulkan::FlushAllocation(texture.StagingBuffer.Allocation, 0, texture.StagingBuffer.Size);
+    }
+
+    Render::TextureID Render::uploadTexture(PreparedTexture &texture) {
+        // An earlier texture of the same import may have loaded the key since it was prepared.
+        if (m_LoadedTextures.contains(texture.Key)) {
+            if (texture.StagingBuffer.Handle)
+                Vulkan::DestroyBuffer(texture.StagingBuffer);
+
+            const auto texture_id = m_LoadedTextures.at(texture.Key);
+            m_LoadedTextureRCs.at(texture_id)++;
+            return texture_id;
+        }
+
+        // Skipped by its job, the materials use their default maps instead.
+        if (!texture.Asset.has_value() && !texture.CompressedAsset.has_value())
+            return k_InvalidTextureID;
+
+        const TextureAsset &upload_asset = texture.CompressedAsset.has_value() ? texture.CompressedAsset.value() : texture.Asset.value();
+
+        const Vulkan::Buffer &staging_buffer = texture.StagingBuffer;
+
+        const bool has_mip_levels = texture.HasMipLevels;
+
+        const vk::Extent2D extent = texture.Extent;
+
+        // The image only holds the resident levels, streaming rebuilds it with more or fewer of them.
+        const uint32_t first_mip_level = upload_asset.getFirstMipLevel();
+
+        const Vulkan::Image image =
+            has_mip_levels
+                ? Vulkan::AllocateImage2DArray(
+                      {}, vma::MemoryUsage::eGpuOnly, {},
+                      texture.Format,
+                      vk::ImageUsageFlagBits::eSampled |
+                          vk::ImageUsageFlagBits::eTransferSrc |
+                          vk::ImageUsageFlagBits::eTransferDst,
+                      upload_asset.getResidentMipLevelCount(),
+                      upload_asset.getLayerCount(),
+                      vk::Extent2D{upload_asset.getMipWidth(first_mip_level), upload_asset.getMipHeight(first_mip_level)})
+                : Vulkan::AllocateImage2DWithMipLevels(
+                      {}, vma::MemoryUsage::eGpuOnly, {},
+                      texture.Format,
+                      vk::ImageUsageFlagBits::eSampled |
+                          vk::ImageUsageFlagBits::eTransferSrc |
+                          vk::ImageUsageFlagBits::eTransferDst,
+                      extent);
+        // Materials sample the first layer, the remaining layers and faces stay resident with it.
+        const vk::ImageView view = Vulkan::CreateImageColorView2DWithMipLevels(image.Handle, image.Format, 0, image.MipLevelCount);
 
         Vulkan::ImmediateSubmit([&](const vk::CommandBuffer command_buffer) {
             Vulkan::BarrierMerger merger{};
@@ -893,14 +1127,42 @@ namespace Ignis {
                 vk::PipelineStageFlagBits2::eNone,
                 vk::AccessFlagBits2::eNone);
             merger.flushBarriers(command_buffer);
-            Vulkan::CopyBufferToImage(
-                staging_buffer.Handle,
-                image.Handle,
-                0,
-                vk::Offset3D{0, 0, 0},
-                vk::Extent2D{0, 0},
-                image.Extent,
-                command_buffer);
+
+            if (!has_mip_levels) {
+                Vulkan::CopyBufferToImage(
+                    staging_buffer.Handle,
+                    image.Handle,
+                    0,
+                    vk::Offset3D{0, 0, 0},
+                    vk::Extent2D{0, 0},
+                    image.Extent,
+                    command_buffer);
+                // Blits filter linearly in the image's format, so sRGB levels are averaged in linear space.
+                Vulkan::GenerateImage2DMipLevels(
+                    image.Handle,
+                    vk::ImageLayout::eTransferDstOptimal,
+                    vk::ImageLayout::eShaderReadOnlyOptimal,
+                    image.MipLevelCount,
+                    extent,
+                    command_buffer);
+                return;
+            }
+
+            const uint32_t end_mip_level = first_mip_level + upload_asset.getResidentMipLevelCount();
+
+            for (uint32_t mip_level = first_mip_level; mip_level < end_mip_level; mip_level++) {
+                Vulkan::CopyBufferToImage(
+                    staging_buffer.Handle,
+                    image.Handle,
+                    mip_level - first_mip_level,
+                    upload_asset.getLayerCount(),
+                    upload_asset.getMipOffset(mip_level),
+                    vk::Offset3D{0, 0, 0},
+                    vk::Extent2D{0, 0},
+                    vk::Extent3D{upload_asset.getMipWidth(mip_level), upload_asset.getMipHeight(mip_level), 1},
+                    command_buffer);
+            }
+
             merger.putImageBarrier(
                 image.Handle,
                 vk::ImageLayout::eTransferDstOptimal,
@@ -912,68 +1174,37 @@ namespace Ignis {
             merger.flushBarriers(command_buffer);
         });
 
-        Vulkan::DestroyBuffer(staging_buffer);
+        Vulkan::DestroyBuffer(texture.StagingBuffer);
 
-        const TextureID id = addTexture(image, view);
+        const TextureID id = addTexture(image, view, first_mip_level);
 
-        m_LoadedTextures.emplace(texture_path, id);
-        m_LoadedTexturePaths.emplace(id, texture_path);
+        m_LoadedTextures.emplace(texture.Key, id);
+        m_LoadedTextureKeys.emplace(id, texture.Key);
         m_LoadedTextureRCs.emplace(id, 1);
 
-        return id;
-    }
-
-    int32_t GetSMikkTSpaceNumFaces(const SMikkTSpaceContext *context) {
-        return static_cast<int32_t>(static_cast<const SMikkTSpaceMesh *>(context->m_pUserData)->IndexCount) / 3;
-    }
-
-    int32_t GetSMikkTSpaceNumVerticesPerFace(const SMikkTSpaceContext *, const int32_t) {
-        return 3;
-    }
-
-    void GetSMikkTSpacePosition(const SMikkTSpaceContext *context, glm::f32 o_fv_position[3], const int32_t i_face, const int32_t i_vertex) {
-        const auto *mesh     = static_cast<const SMikkTSpaceMesh *>(context->m_pUserData);
-        const auto &index    = mesh->Indices[i_face * 3 + i_vertex];
-        const auto &vertex   = mesh->Vertices[index];
-        const auto &position = vertex.Position;
-
-        o_fv_position[0] = position.x;
-        o_fv_position[1] = position.y;
-        o_fv_position[2] = position.z;
-    }
-
-    void GetSMikkTSpaceNormal(const SMikkTSpaceContext *context, glm::f32 o_fv_normal[3], const int32_t i_face, const int32_t i_vertex) {
-        const auto *mesh   = static_cast<const SMikkTSpaceMesh *>(context->m_pUserData);
-        const auto &index  = mesh->Indices[i_face * 3 + i_vertex];
-        const auto &vertex = mesh->Vertices[index];
-        const auto &normal = vertex.Normal;
+        if (0 != first_mip_level)
+            streamTexture(id, std::move(texture.File.value()), texture.IsKTX2, texture.Format, upload_asset);
 
-        o_fv_normal[0] = normal.x;
-        o_fv_normal[1] = normal.y;
-        o_fv_normal[2] = normal.z;
+        return id;
     }
 
-    void GetSMikkTSpaceUV(const SMikkTSpaceContext *context, glm::f32 o_fv_uv[2], const int32_t i_face, const int32_t i_vertex) {
-        const auto *mesh   = static_cast<const SMikkTSpaceMesh *>(context->m_pUserData);
-        const auto &index  = mesh->Indices[i_face * 3 + i_vertex];
-        const auto &vertex = mesh->Vertices[index];
-        const auto &uv     = vertex.UV;
+    std::optional<FileAsset> LoadTextureFile(
+        const Render::CookedModel   &cooked_model,
+        const Render::CookedTexture &texture,
+        const std::filesystem::path &texture_path) {
+        if (texture.EmbeddedData.empty())
+            return FileAsset::LoadBinaryFromPath(texture_path);
+
+        // Embedded textures keep the cooked model's mapping alive for as long as their levels stream.
+        const std::shared_ptr<const std::byte> data{
+            cooked_model.File.getSharedData(),
+            reinterpret_cast<const std::byte *>(texture.EmbeddedData.data()),
+        };
 
-        o_fv_uv[0] = uv.x;
-        o_fv_uv[1] = uv.y;
+        return FileAsset::LoadFromSharedMemory(texture_path, data, texture.EmbeddedData.size());
     }
 
-    void SetSMikkTSpaceBasic(const SMikkTSpaceContext *context, const glm::f32 fv_tangent[3], const glm::f32 f_sign, const int32_t i_face, const int32_t i_vertex) {
-        const auto *mesh  = static_cast<SMikkTSpaceMesh *>(context->m_pUserData);
-        const auto &index = mesh->Indices[i_face * 3 + i_vertex];
-
-        auto &vertex  = mesh->Vertices[index];
-        auto &tangent = vertex.Tangent;
-
-        tangent.x = fv_tangent[0];
-        tangent.y = fv_tangent[1];
-        tangent.z = fv_tangent[2];
-        tangent.w = f_sign;
+    uint64_t GetTextureImportKey(const uint32_t texture_index, const Render::TextureRole role) {
+        return static_cast<uint64_t>(texture_index) << 32 | static_cast<uint32_t>(role);
     }
-
-}  // namespace Ignis
\ No newline at end of file
+}  // namespace Ignis
@@ -0,0 +1,109 @@
+#include <Ignis/Render.hpp>
+
+namespace Ignis {
+    void Render::initializePagePool(
+        PagePool                     &pool,
+        const uint64_t                element_size,
+        const uint32_t                elements_per_page,
+        const vk::BufferUsageFlags    usage,
+        const vk::PipelineStageFlags2 stage_mask,
+        const UploadStrategy          strategy,
+        const vk::DescriptorSet       descriptor_set,
+        const uint32_t                binding) {
+        pool.ElementSize     = element_size;
+        pool.ElementsPerPage = elements_per_page;
+        pool.Usage           = usage;
+        pool.StageMask       = stage_mask;
+        pool.Strategy        = strategy;
+        pool.DescriptorSet   = descriptor_set;
+        pool.Binding         = binding;
+
+        pool.Pages.clear();
+        pool.FrameGraphPages.clear();
+        pool.FreePages.clear();
+
+        pool.ReleasedPages.clear();
+        pool.RetiredPages.clear();
+        pool.RetiredPages.resize(Frame::GetRef().getFramesInFlight());
+    }
+
+    void Render::releasePagePool(PagePool &pool) {
+        for (const auto &frame_graph_page : pool.FrameGraphPages)
+            m_pFrameGraph->removeBuffer(frame_graph_page.Buffer);
+
+        for (const auto &page : pool.Pages) {
+            discardUploads(page.Handle);
+            Vulkan::DestroyBuffer(page);
+        }
+
+        pool.Pages.clear();
+        pool.FrameGraphPages.clear();
+        pool.FreePages.clear();
+
+        pool.ReleasedPages.clear();
+        pool.RetiredPages.clear();
+    }
+
+    uint32_t Render::allocatePage(PagePool &pool) {
+        if (!pool.FreePages.empty()) {
+            const uint32_t page = pool.FreePages.back();
+            pool.FreePages.pop_back();
+            return page;
+        }
+
+        const auto page = static_cast<uint32_t>(pool.Pages.size());
+
+        const Vulkan::Buffer buffer = allocateUploadBuffer(
+            pool.Strategy,
+            pool.ElementSize * pool.ElementsPerPage,
+            pool.Usage);
+
+        pool.Pages.push_back(buffer);
+        pool.FrameGraphPages.push_back(FrameGraph::BufferInfo{
+            m_pFrameGraph->importBuffer(buffer.Handle, buffer.Usage, 0, buffer.Size),
+            0,
+            buffer.Size,
+            pool.StageMask,
+        });
+
+        Vulkan::DescriptorSetWriter()
+            .writeStorageBuffer(pool.Binding, page, buffer.Handle, 0, buffer.Size)
+            .update(pool.DescriptorSet);
+
+        return page;
+    }
+
+    void Render::freePage(PagePool &pool, const uint32_t page) {
+        DIGNIS_ASSERT(page < pool.Pages.size());
+        pool.ReleasedPages.push_back(page);
+    }
+
+    void Render::recyclePages(PagePool &pool) {
+        std::vector<uint32_t> &retired_pages = pool.RetiredPages[Frame::GetRef().getFrameIndex()];
+
+        // Retired the last time this frame index was recorded, every frame that could read them has finished since.
+        pool.FreePages.insert(std::end(pool.FreePages), std::begin(retired_pages), std::end(retired_pages));
+        retired_pages.clear();
+
+        // Pages freed since the last frame were last read by the frames still in flight, this frame no longer maps them.
+        std::swap(retired_pages, pool.ReleasedPages);
+    }
+
+    void Render::reservePages(PagePool &pool, const uint32_t element_count) {
+        while (pool.Pages.size() * pool.ElementsPerPage < element_count)
+            allocatePage(pool);
+    }
+
+    vk::Buffer Render::getPageBuffer(const PagePool &pool, const uint32_t element) const {
+        DIGNIS_ASSERT(element / pool.ElementsPerPage < pool.Pages.size());
+        return pool.Pages[element / pool.ElementsPerPage].Handle;
+    }
+
+    uint64_t Render::getPageOffset(const PagePool &pool, const uint32_t element) const {
+        return pool.ElementSize * (element % pool.ElementsPerPage);
+    }
+
+    void Render::readPagePool(const PagePool &pool, FrameGraph::RenderPass &render_pass) const {
+        render_pass.readBuffers(pool.FrameGraphPages);
+    }
+}  // namespace Ignis
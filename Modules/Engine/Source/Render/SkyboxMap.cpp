@@ -76,7 +76,28 @@ namespace Ignis {
         const vk::ImageView render_image_view =
             Vulkan::CreateImageColorView2DArray(m_SkyboxImage.Handle, m_SkyboxImage.Format, 0, 6);
 
-        const TextureAsset texture_asset = TextureAsset::LoadFromPath(skybox_path, TextureAsset::Type::eRGBA32f).value();
+        // The texels are decoded into the front of the staging buffer, the cube geometry follows them.
+        Vulkan::Buffer                staging{};
+        const TextureAsset::Allocator allocate_staging =
+            MakeTextureStagingAllocator(staging, m_SkyboxVertexBuffer.Size + m_SkyboxIndexBuffer.Size);
+
+        std::optional<TextureAsset> texture_asset_opt = std::nullopt;
+        if (m_AssetDatabase.has_value()) {
+            if (const std::optional<std::filesystem::path> cooked_path = m_AssetDatabase->findCooked(skybox_path);
+                cooked_path.has_value())
+                texture_asset_opt = TextureAsset::LoadKTX2FromPath(
+                    cooked_path.value(),
+                    [&allocate_staging](const TextureAsset &texture_asset, const uint64_t size) {
+                        return TextureAsset::Type::eRGBA32f == texture_asset.getType()
+                                   ? allocate_staging(texture_asset, size)
+                                   : std::span<uint8_t>{};
+                    });
+        }
+        // The cooked skybox skips decoding the HDR, it is stored as the eRGBA32f texels uploaded here.
+        if (!texture_asset_opt.has_value())
+            texture_asset_opt = TextureAsset::LoadFromPath(skybox_path, TextureAsset::Type::eRGBA32f, allocate_staging);
+
+        const TextureAsset texture_asset = std::move(texture_asset_opt.value());
 
         const uint64_t texture_asset_size = texture_asset.getData().size();
 
@@ -93,14 +114,6 @@ namespace Ignis {
             .writeCombinedImageSampler(0, skybox_image_view, vk::ImageLayout::eShaderReadOnlyOptimal, m_Sampler)
             .update(descriptor_set);
 
-        const Vulkan::Buffer staging = Vulkan::AllocateBuffer(
-            vma::AllocationCreateFlagBits::eMapped,
-            vma::MemoryUsage::eCpuOnly, {},
-            texture_asset_size +
-                m_SkyboxVertexBuffer.Size +
-                m_SkyboxIndexBuffer.Size,
-            vk::BufferUsageFlagBits::eTransferSrc);
-
         constexpr glm::vec3 vertices[]{
             glm::vec3{-1.0f, -1.0f, -1.0f},  // 0
             glm::vec3{1.0f, -1.0f, -1.0f},   // 1
@@ -138,9 +151,9 @@ namespace Ignis {
             2, 3, 0};
 
         {
-            uint64_t offset = 0;
-            Vulkan::CopyMemoryToAllocation(texture_asset.getData().data(), staging.Allocation, offset, texture_asset_size);
-            offset += texture_asset_size;
+            Vulkan::FlushAllocation(staging.Allocation, 0, texture_asset_size);
+
+            uint64_t offset = texture_asset_size;
             Vulkan::CopyMemoryToAllocation(vertices, staging.Allocation, offset, m_SkyboxVertexBuffer.Size);
             offset += m_SkyboxVertexBuffer.Size;
             Vulkan::CopyMemoryToAllocation(indices, staging.Allocation, offset, m_SkyboxIndexBuffer.Size);
@@ -0,0 +1,585 @@
+#include <Ignis/Render.hpp>
+
+namespace Ignis {
+    void Render::initializeStreaming(const Settings &settings) {
+        m_TextureStreamingBudget     = settings.TextureStreamingBudget;
+        m_TextureStreamingTailExtent = 0 != m_TextureStreamingBudget ? settings.TextureStreamingTailExtent : ~0u;
+        m_TextureMemoryBudget        = settings.TextureMemoryBudget;
+
+        m_NextStreamSerial = 0;
+        m_ResidencyFrame   = 0;
+
+        m_StreamingTextures.clear();
+        m_StreamedTextureMemory = 0;
+
+        m_StreamRetirements.clear();
+        m_StreamRetirements.resize(Frame::GetRef().getFramesInFlight());
+
+        m_StreamRequests.clear();
+        m_StreamResults.clear();
+        m_StreamResultSize = 0;
+
+        if (0 != m_TextureStreamingBudget) {
+            m_StreamThread = std::jthread{[this](const std::stop_token &stop_token) {
+                runTextureStreamer(stop_token);
+            }};
+        }
+    }
+
+    void Render::releaseStreaming() {
+        // Stopping wakes the stream thread, a level it is decoding still lands in the results.
+        if (m_StreamThread.joinable()) {
+            m_StreamThread.request_stop();
+            m_StreamThread.join();
+        }
+
+        for (const StreamResult &result : m_StreamResults) {
+            if (result.StagingBuffer.Handle)
+                Vulkan::DestroyBuffer(result.StagingBuffer);
+        }
+
+        for (const StreamRetirement &retirement : m_StreamRetirements) {
+            for (const Vulkan::Buffer &staging_buffer : retirement.Buffers)
+                Vulkan::DestroyBuffer(staging_buffer);
+            for (const vk::ImageView &view : retirement.Views)
+                Vulkan::DestroyImageView(view);
+            for (const Vulkan::Image &image : retirement.Images)
+                Vulkan::DestroyImage(image);
+        }
+
+        m_StreamingTextures.clear();
+        m_StreamRetirements.clear();
+
+        m_StreamRequests.clear();
+        m_StreamResults.clear();
+        m_StreamResultSize = 0;
+    }
+
+    void Render::streamTexture(
+        const TextureID     id,
+        FileAsset           file,
+        const bool          is_ktx2,
+        const vk::Format    format,
+        const TextureAsset &tail_asset) {
+        DIGNIS_ASSERT(0 != tail_asset.getFirstMipLevel(), "The texture has no levels left to stream.");
+
+        StreamingTexture streaming_texture{};
+        streaming_texture.Serial = m_NextStreamSerial++;
+        streaming_texture.File   = std::move(file);
+        streaming_texture.IsKTX2 = is_ktx2;
+
+        streaming_texture.Format        = format;
+        streaming_texture.Extent        = vk::Extent2D{tail_asset.getWidth(), tail_asset.getHeight()};
+        streaming_texture.MipLevelCount = tail_asset.getMipLevelCount();
+        streaming_texture.LayerCount    = tail_asset.getLayerCount();
+
+        streaming_texture.ResidentMipLevel = tail_asset.getFirstMipLevel();
+        streaming_texture.TailMipLevel     = tail_asset.getFirstMipLevel();
+        streaming_texture.FinestMipLevel   = 0;
+
+        // Nothing streams in until the shading has asked for it.
+        streaming_texture.RequestedMipLevel = tail_asset.getFirstMipLevel();
+        streaming_texture.LastUsedFrame     = m_ResidencyFrame;
+
+        streaming_texture.SlotParity   = 0;
+        streaming_texture.RebuildFrame = m_ResidencyFrame;
+
+        streaming_texture.ImageSize   = Vulkan::GetAllocationInfo(m_Textures.at(id).Allocation).size;
+        streaming_texture.IsStreaming = false;
+
+        m_StreamedTextureMemory += streaming_texture.ImageSize;
+
+        m_StreamingTextures.insert_or_assign(id, std::move(streaming_texture));
+    }
+
+    void Render::stopTextureStream(const TextureID id) {
+        const auto streaming_texture = m_StreamingTextures.find(id);
+        if (m_StreamingTextures.end() == streaming_texture)
+            return;
+
+        const uint64_t serial = streaming_texture->second.Serial;
+
+        m_StreamedTextureMemory -= streaming_texture->second.ImageSize;
+
+        m_StreamingTextures.erase(streaming_texture);
+
+        // A level already being decoded is dropped by its serial when it comes back.
+        std::scoped_lock lock{m_StreamMutex};
+        std::erase_if(m_StreamRequests, [serial](const StreamRequest &request) {
+            return serial == request.Serial;
+        });
+    }
+
+    void Render::requestStreamLevel(const TextureID id) {
+        StreamingTexture &streaming_texture = m_StreamingTextures.at(id);
+
+        streaming_texture.IsStreaming = true;
+
+        StreamRequest request{};
+        request.ID       = id;
+        request.Serial   = streaming_texture.Serial;
+        request.MipLevel = streaming_texture.ResidentMipLevel - 1;
+        request.File     = streaming_texture.File;
+        request.IsKTX2   = streaming_texture.IsKTX2;
+
+        // Requests are served in order, so every texture gets its next level before any gets the one after.
+        {
+            std::scoped_lock lock{m_StreamMutex};
+            m_StreamRequests.push_back(std::move(request));
+        }
+        m_StreamCondition.notify_one();
+    }
+
+    void Render::runTextureStreamer(const std::stop_token &stop_token) {
+        const uint64_t max_result_size = k_TextureStreamAheadFrames * m_TextureStreamingBudget;
+
+        while (!stop_token.stop_requested()) {
+            StreamRequest request{};
+            {
+                std::unique_lock lock{m_StreamMutex};
+
+                // Decoded levels wait in staging memory for their upload, so decoding stops a few frames ahead.
+                const bool has_request = m_StreamCondition.wait(lock, stop_token, [this, max_result_size] {
+                    return !m_StreamRequests.empty() && m_StreamResultSize < max_result_size;
+                });
+                if (!has_request || stop_token.stop_requested())
+                    return;
+
+                request = std::move(m_StreamRequests.front());
+                m_StreamRequests.pop_front();
+            }
+
+            StreamResult result{};
+            result.ID       = request.ID;
+            result.Serial   = request.Serial;
+            result.MipLevel = request.MipLevel;
+
+            const TextureAsset::Allocator allocate_staging = MakeTextureStagingAllocator(result.StagingBuffer);
+            const TextureAsset::MipRange  mip_range{request.MipLevel, 1};
+
+            // Reading the level faults its pages in from the mapped container, the I/O stays on this thread too.
+            const std::span<const std::byte> bytes = request.File.getBytes();
+
+            result.Asset =
+                request.IsKTX2
+                    ? TextureAsset::LoadKTX2FromMemory(bytes.data(), bytes.size(), allocate_staging, mip_range)
+                    : TextureAsset::LoadDDSFromMemory(bytes.data(), bytes.size(), allocate_staging, mip_range);
+            if (result.Asset.has_value())
+                Vulkan::FlushAllocation(result.StagingBuffer.Allocation, 0, result.StagingBuffer.Size);
+
+            std::scoped_lock lock{m_StreamMutex};
+            m_StreamResultSize += result.StagingBuffer.Size;
+            m_StreamResults.push_back(std::move(result));
+        }
+    }
+
+    void Render::allocateTextureFeedbackBuffer(const uint32_t texture_capacity) {
+        if (m_TextureFeedbackBuffer.Handle) {
+            // Frames in flight still write into the old buffer.
+            Vulkan::WaitDeviceIdle();
+            releaseTextureFeedbackBuffer();
+        }
+
+        m_TextureFeedbackCapacity = texture_capacity;
+
+        const uint64_t size = static_cast<uint64_t>(Frame::GetRef().getFramesInFlight()) * texture_capacity * sizeof(uint32_t);
+
+        m_TextureFeedbackBuffer = Vulkan::AllocateBuffer(
+            vma::AllocationCreateFlagBits::eMapped |
+                vma::AllocationCreateFlagBits::eHostAccessRandom,
+            vma::MemoryUsage::eGpuToCpu, {},
+            size,
+            vk::BufferUsageFlagBits::eStorageBuffer);
+
+        std::memset(Vulkan::GetAllocationInfo(m_TextureFeedbackBuffer).pMappedData, 0xFF, size);
+        Vulkan::FlushAllocation(m_TextureFeedbackBuffer.Allocation, 0, size);
+
+        Vulkan::DescriptorSetWriter()
+            .writeStorageBuffer(6, m_TextureFeedbackBuffer.Handle, 0, size)
+            .update(m_MaterialDescriptorSet);
+    }
+
+    void Render::releaseTextureFeedbackBuffer() {
+        Vulkan::DestroyBuffer(m_TextureFeedbackBuffer);
+
+        m_TextureFeedbackBuffer   = Vulkan::Buffer{};
+        m_TextureFeedbackCapacity = 0;
+    }
+
+    uint32_t Render::getTextureFeedbackBase() const {
+        return Frame::GetRef().getFrameIndex() * m_TextureFeedbackCapacity;
+    }
+
+    void Render::readTextureFeedback() {
+        const uint64_t slice_offset = static_cast<uint64_t>(getTextureFeedbackBase()) * sizeof(uint32_t);
+        const uint64_t slice_size   = static_cast<uint64_t>(m_TextureFeedbackCapacity) * sizeof(uint32_t);
+
+        // The frame fence has been waited on, so this slice holds what the frame before it sampled.
+        Vulkan::InvalidateAllocation(m_TextureFeedbackBuffer.Allocation, slice_offset, slice_size);
+
+        auto *feedback = reinterpret_cast<uint32_t *>(
+            static_cast<std::byte *>(Vulkan::GetAllocationInfo(m_TextureFeedbackBuffer).pMappedData) + slice_offset);
+
+        for (auto &[id, streaming_texture] : m_StreamingTextures) {
+            const uint32_t requested_mip_level = feedback[id.ID];
+            if (~0u == requested_mip_level)
+                continue;
+
+            streaming_texture.RequestedMipLevel = std::min(requested_mip_level, streaming_texture.TailMipLevel);
+            streaming_texture.LastUsedFrame     = m_ResidencyFrame;
+        }
+
+        std::memset(feedback, 0xFF, slice_size);
+        Vulkan::FlushAllocation(m_TextureFeedbackBuffer.Allocation, slice_offset, slice_size);
+    }
+
+    void Render::updateTextureResidency(std::vector<TextureRebuild> &rebuilds) {
+        const uint64_t memory_limit = getTextureMemoryLimit();
+
+        if (m_StreamedTextureMemory > memory_limit) {
+            std::vector<TextureID> evictable_textures{};
+            for (const auto &[id, streaming_texture] : m_StreamingTextures) {
+                if (streaming_texture.ResidentMipLevel < streaming_texture.TailMipLevel && canRebuildTexture(streaming_texture))
+                    evictable_textures.push_back(id);
+            }
+
+            std::ranges::sort(evictable_textures, {}, [this](const TextureID id) {
+                return m_StreamingTextures.at(id).LastUsedFrame;
+            });
+
+            for (const TextureID id : evictable_textures) {
+                if (m_StreamedTextureMemory <= memory_limit)
+                    break;
+
+                const StreamingTexture &streaming_texture = m_StreamingTextures.at(id);
+
+                // Textures out of sight drop to their tail, the ones still on screen give up their largest level only.
+                const uint32_t mip_level =
+                    m_ResidencyFrame != streaming_texture.LastUsedFrame
+                        ? streaming_texture.TailMipLevel
+                        : streaming_texture.ResidentMipLevel + 1;
+
+                rebuildTexture(id, mip_level, nullptr, rebuilds);
+            }
+        }
+
+        // A level doubles both sides, so a rebuilt chain is about four times the size of the one it replaces.
+        uint64_t projected_memory = m_StreamedTextureMemory;
+        for (const StreamingTexture &streaming_texture : std::views::values(m_StreamingTextures)) {
+            if (streaming_texture.IsStreaming)
+                projected_memory += 3 * streaming_texture.ImageSize;
+        }
+
+        for (auto &[id, streaming_texture] : m_StreamingTextures) {
+            const uint32_t wanted_mip_level = std::max(streaming_texture.RequestedMipLevel, streaming_texture.FinestMipLevel);
+
+            if (streaming_texture.IsStreaming ||
+                m_ResidencyFrame != streaming_texture.LastUsedFrame ||
+                streaming_texture.ResidentMipLevel <= wanted_mip_level ||
+                !canRebuildTexture(streaming_texture))
+                continue;
+
+            const uint64_t growth = 3 * streaming_texture.ImageSize;
+            if (projected_memory + growth > memory_limit)
+                continue;
+
+            projected_memory += growth;
+
+            requestStreamLevel(id);
+        }
+    }
+
+    void Render::rebuildTexture(
+        const TextureID              id,
+        const uint32_t               mip_level,
+        const vk::Buffer             staging_buffer,
+        std::vector<TextureRebuild> &rebuilds) {
+        StreamingTexture &streaming_texture = m_StreamingTextures.at(id);
+
+        DIGNIS_ASSERT(canRebuildTexture(streaming_texture));
+
+        const Vulkan::Image src_image = m_Textures.at(id);
+        const vk::ImageView src_view  = m_TextureViews.at(id);
+
+        const Vulkan::Image image = Vulkan::AllocateImage2DArray(
+            {}, vma::MemoryUsage::eGpuOnly, {},
+            streaming_texture.Format,
+            vk::ImageUsageFlagBits::eSampled |
+                vk::ImageUsageFlagBits::eTransferSrc |
+                vk::ImageUsageFlagBits::eTransferDst,
+            streaming_texture.MipLevelCount - mip_level,
+            streaming_texture.LayerCount,
+            vk::Extent2D{
+                std::max(streaming_texture.Extent.width >> mip_level, 1u),
+                std::max(streaming_texture.Extent.height >> mip_level, 1u),
+            });
+        const vk::ImageView view = Vulkan::CreateImageColorView2DWithMipLevels(image.Handle, image.Format, 0, image.MipLevelCount);
+
+        rebuilds.push_back(TextureRebuild{
+            src_image.Handle,
+            image.Handle,
+            staging_buffer,
+            streaming_texture.ResidentMipLevel,
+            mip_level,
+            streaming_texture.MipLevelCount,
+            streaming_texture.LayerCount,
+            streaming_texture.Extent,
+        });
+
+        // The other slot has left flight, so it can be written while the frames in flight still sample this one.
+        streaming_texture.SlotParity ^= 1u;
+
+        Vulkan::DescriptorSetWriter()
+            .writeCombinedImageSampler(0, GetTextureSlot(id, streaming_texture.SlotParity), view, vk::ImageLayout::eShaderReadOnlyOptimal, m_TextureSampler)
+            .update(m_MaterialDescriptorSet);
+
+        m_pFrameGraph->removeImage(m_FrameGraphImages[id]);
+        m_FrameGraphImages[id] = m_pFrameGraph->importImage(
+            image.Handle, view,
+            image.Format, image.Usage, image.Extent,
+            vk::ImageLayout::eShaderReadOnlyOptimal,
+            vk::ImageLayout::eShaderReadOnlyOptimal);
+
+        StreamRetirement &retirement = m_StreamRetirements[Frame::GetRef().getFrameIndex()];
+        retirement.Images.push_back(src_image);
+        retirement.Views.push_back(src_view);
+
+        m_Textures.at(id)     = image;
+        m_TextureViews.at(id) = view;
+
+        const uint64_t image_size = Vulkan::GetAllocationInfo(image.Allocation).size;
+
+        m_StreamedTextureMemory = m_StreamedTextureMemory - streaming_texture.ImageSize + image_size;
+
+        streaming_texture.ImageSize        = image_size;
+        streaming_texture.ResidentMipLevel = mip_level;
+        streaming_texture.RebuildFrame     = m_ResidencyFrame;
+
+        setTextureState(id, TextureState{GetTextureSlot(id, streaming_texture.SlotParity), mip_level});
+    }
+
+    bool Render::canRebuildTexture(const StreamingTexture &streaming_texture) const {
+        return streaming_texture.RebuildFrame + Frame::GetRef().getFramesInFlight() <= m_ResidencyFrame;
+    }
+
+    uint64_t Render::getTextureMemoryLimit() const {
+        const uint64_t memory_limit = 0 != m_TextureMemoryBudget ? m_TextureMemoryBudget : std::numeric_limits<uint64_t>::max();
+
+        if (m_StreamingTextures.empty())
+            return memory_limit;
+
+        // Streamed images all come from the same heap, whatever else lives on it is left its share.
+        const vma::Budget heap_budget = Vulkan::GetAllocationHeapBudget(m_Textures.at(m_StreamingTextures.begin()->first).Allocation);
+
+        // A tenth of the budget stays free for what gets allocated between two frames.
+        const uint64_t heap_limit  = heap_budget.budget - heap_budget.budget / 10;
+        const uint64_t other_usage = heap_budget.usage > m_StreamedTextureMemory ? heap_budget.usage - m_StreamedTextureMemory : 0;
+
+        return std::min(memory_limit, heap_limit > other_usage ? heap_limit - other_usage : 0);
+    }
+
+    void Render::recordTextureStreaming(FrameGraph &frame_graph) {
+        m_ResidencyFrame++;
+
+        StreamRetirement &retirement = m_StreamRetirements[Frame::GetRef().getFrameIndex()];
+
+        // The frame fence has been waited on, so the copies this frame recorded last time are done.
+        for (const Vulkan::Buffer &staging_buffer : retirement.Buffers)
+            Vulkan::DestroyBuffer(staging_buffer);
+        for (const vk::ImageView &view : retirement.Views)
+            Vulkan::DestroyImageView(view);
+        for (const Vulkan::Image &image : retirement.Images)
+            Vulkan::DestroyImage(image);
+
+        retirement.Buffers.clear();
+        retirement.Views.clear();
+        retirement.Images.clear();
+
+        if (0 == m_TextureStreamingBudget)
+            return;
+
+        readTextureFeedback();
+
+        // Levels are taken in the order they were decoded until the budget is spent, one always goes through.
+        std::vector<StreamResult> results{};
+        {
+            std::scoped_lock lock{m_StreamMutex};
+
+            uint64_t upload_size = 0;
+            while (!m_StreamResults.empty()) {
+                const uint64_t size = m_StreamResults.front().StagingBuffer.Size;
+                if (!results.empty() && upload_size + size > m_TextureStreamingBudget)
+                    break;
+
+                upload_size += size;
+                m_StreamResultSize -= size;
+
+                results.push_back(std::move(m_StreamResults.front()));
+                m_StreamResults.pop_front();
+            }
+        }
+
+        if (!results.empty())
+            m_StreamCondition.notify_one();
+
+        std::vector<TextureRebuild> rebuilds{};
+
+        for (StreamResult &result : results) {
+            const auto streaming_texture = m_StreamingTextures.find(result.ID);
+
+            const bool is_current =
+                m_StreamingTextures.end() != streaming_texture &&
+                streaming_texture->second.Serial == result.Serial;
+
+            if (is_current)
+                streaming_texture->second.IsStreaming = false;
+
+            if (is_current && !result.Asset.has_value()) {
+                DIGNIS_LOG_ENGINE_WARN(
+                    "Failed to stream mip level {} of a texture, it stays at level {}",
+                    result.MipLevel, streaming_texture->second.ResidentMipLevel);
+                streaming_texture->second.FinestMipLevel = result.MipLevel + 1;
+            }
+
+            // Levels evicted while this one was decoding leave it nothing to sit on.
+            const bool is_applicable =
+                is_current &&
+                result.Asset.has_value() &&
+                result.MipLevel + 1 == streaming_texture->second.ResidentMipLevel &&
+                canRebuildTexture(streaming_texture->second);
+
+            if (!is_applicable) {
+                // Nothing was recorded from it, so it goes right away.
+                if (result.StagingBuffer.Handle)
+                    Vulkan::DestroyBuffer(result.StagingBuffer);
+                continue;
+            }
+
+            retirement.Buffers.push_back(result.StagingBuffer);
+
+            rebuildTexture(result.ID, result.MipLevel, result.StagingBuffer.Handle, rebuilds);
+        }
+
+        updateTextureResidency(rebuilds);
+
+        if (rebuilds.empty())
+            return;
+
+        FrameGraph::ComputePass stream_pass{
+            "Ignis::Render::Texture Stream Pass",
+            {1.0f, 0.5f, 0.0f, 1.0f},
+        };
+
+        stream_pass.setExecute([rebuilds = std::move(rebuilds)](const vk::CommandBuffer command_buffer) {
+            // The upload pass after this one binds the new images, until then only the old ones are sampled.
+            Vulkan::BarrierMerger merger{};
+            for (const TextureRebuild &rebuild : rebuilds) {
+                merger.putImageBarrier(
+                    rebuild.SrcImage,
+                    vk::ImageLayout::eShaderReadOnlyOptimal,
+                    vk::ImageLayout::eTransferSrcOptimal,
+                    0, rebuild.MipLevelCount - rebuild.SrcMipLevel,
+                    0, rebuild.LayerCount,
+                    vk::PipelineStageFlagBits2::eFragmentShader,
+                    vk::AccessFlagBits2::eShaderSampledRead,
+                    vk::PipelineStageFlagBits2::eTransfer,
+                    vk::AccessFlagBits2::eTransferRead);
+                merger.putImageBarrier(
+                    rebuild.DstImage,
+                    vk::ImageLayout::eUndefined,
+                    vk::ImageLayout::eTransferDstOptimal,
+                    0, rebuild.MipLevelCount - rebuild.DstMipLevel,
+                    0, rebuild.LayerCount,
+                    vk::PipelineStageFlagBits2::eNone,
+                    vk::AccessFlagBits2::eNone,
+                    vk::PipelineStageFlagBits2::eTransfer,
+                    vk::AccessFlagBits2::eTransferWrite);
+            }
+            merger.flushBarriers(command_buffer);
+
+            for (const TextureRebuild &rebuild : rebuilds) {
+                const uint32_t first_copied_mip_level = std::max(rebuild.SrcMipLevel, rebuild.DstMipLevel);
+
+                if (rebuild.StagingBuffer) {
+                    Vulkan::CopyBufferToImage(
+                        rebuild.StagingBuffer,
+                        rebuild.DstImage,
+                        0,
+                        rebuild.LayerCount,
+                        0,
+                        vk::Offset3D{0, 0, 0},
+                        vk::Extent2D{0, 0},
+                        vk::Extent3D{
+                            std::max(rebuild.Extent.width >> rebuild.DstMipLevel, 1u),
+                            std::max(rebuild.Extent.height >> rebuild.DstMipLevel, 1u),
+                            1,
+                        },
+                        command_buffer);
+                }
+
+                for (uint32_t mip_level = first_copied_mip_level; mip_level < rebuild.MipLevelCount; mip_level++) {
+                    Vulkan::CopyImageToImage(
+                        rebuild.SrcImage,
+                        rebuild.DstImage,
+                        mip_level - rebuild.SrcMipLevel,
+                        mip_level - rebuild.DstMipLevel,
+                        rebuild.LayerCount,
+                        vk::Extent3D{
+                            std::max(rebuild.Extent.width >> mip_level, 1u),
+                            std::max(rebuild.Extent.height >> mip_level, 1u),
+                            1,
+                        },
+                        command_buffer);
+                }
+            }
+
+            // The old images are retired with this frame, they are never sampled again.
+            for (const TextureRebuild &rebuild : rebuilds) {
+                merger.putImageBarrier(
+                    rebuild.DstImage,
+                    vk::ImageLayout::eTransferDstOptimal,
+                    vk::ImageLayout::eShaderReadOnlyOptimal,
+                    0, rebuild.MipLevelCount - rebuild.DstMipLevel,
+                    0, rebuild.LayerCount,
+                    vk::PipelineStageFlagBits2::eTransfer,
+                    vk::AccessFlagBits2::eTransferWrite,
+                    vk::PipelineStageFlagBits2::eFragmentShader,
+                    vk::AccessFlagBits2::eShaderSampledRead);
+            }
+            merger.flushBarriers(command_buffer);
+        });
+
+        frame_graph.addComputePass(stream_pass);
+    }
+
+    void Render::recordTextureFeedback(FrameGraph &frame_graph) const {
+        if (0 == m_TextureStreamingBudget)
+            return;
+
+        FrameGraph::ComputePass feedback_pass{
+            "Ignis::Render::Texture Feedback Pass",
+            {1.0f, 0.5f, 0.0f, 1.0f},
+        };
+
+        const vk::Buffer feedback_buffer = m_TextureFeedbackBuffer.Handle;
+
+        const uint64_t slice_offset = static_cast<uint64_t>(getTextureFeedbackBase()) * sizeof(uint32_t);
+        const uint64_t slice_size   = static_cast<uint64_t>(m_TextureFeedbackCapacity) * sizeof(uint32_t);
+
+        feedback_pass.setExecute([feedback_buffer, slice_offset, slice_size](const vk::CommandBuffer command_buffer) {
+            // The fence alone does not make the shading's writes visible to the host.
+            Vulkan::BarrierMerger merger{};
+            merger.putBufferBarrier(
+                feedback_buffer,
+                slice_offset,
+                slice_size,
+                vk::PipelineStageFlagBits2::eFragmentShader,
+                vk::AccessFlagBits2::eShaderStorageWrite,
+                vk::PipelineStageFlagBits2::eHost,
+                vk::AccessFlagBits2::eHostRead);
+            merger.flushBarriers(command_buffer);
+        });
+
+        frame_graph.addComputePass(feedback_pass);
+    }
+}  // namespace Ignis
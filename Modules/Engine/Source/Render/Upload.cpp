@@ -0,0 +1,178 @@
+#include <Ignis/Render.hpp>
+
+namespace Ignis {
+    void Render::initializeUploads(const Settings &) {
+        m_UploadStagingBuffers.clear();
+        m_UploadStagingBuffers.reserve(Frame::GetRef().getFramesInFlight());
+
+        for (uint32_t i = 0; i < Frame::GetRef().getFramesInFlight(); i++) {
+            m_UploadStagingBuffers.push_back(Vulkan::AllocateBuffer(
+                vma::AllocationCreateFlagBits::eMapped |
+                    vma::AllocationCreateFlagBits::eHostAccessSequentialWrite,
+                vma::MemoryUsage::eAutoPreferHost, {},
+                1 << 16,
+                vk::BufferUsageFlagBits::eTransferSrc));
+        }
+
+        m_PendingUploads.clear();
+        m_PendingUploadData.clear();
+    }
+
+    void Render::releaseUploads() {
+        for (const Vulkan::Buffer &staging_buffer : m_UploadStagingBuffers)
+            Vulkan::DestroyBuffer(staging_buffer);
+
+        m_UploadStagingBuffers.clear();
+
+        m_PendingUploads.clear();
+        m_PendingUploadData.clear();
+    }
+
+    Vulkan::Buffer Render::allocateUploadBuffer(
+        const UploadStrategy       strategy,
+        const uint64_t             size,
+        const vk::BufferUsageFlags usage) const {
+        switch (strategy) {
+            case UploadStrategy::eStaged:
+                return Vulkan::AllocateBuffer(
+                    {}, vma::MemoryUsage::eGpuOnly, {},
+                    size,
+                    usage | vk::BufferUsageFlagBits::eTransferDst);
+            case UploadStrategy::eReBAR:
+                return Vulkan::AllocateBuffer(
+                    vma::AllocationCreateFlagBits::eMapped |
+                        vma::AllocationCreateFlagBits::eHostAccessSequentialWrite |
+                        vma::AllocationCreateFlagBits::eHostAccessAllowTransferInstead,
+                    vma::MemoryUsage::eAutoPreferDevice, {},
+                    size,
+                    usage | vk::BufferUsageFlagBits::eTransferDst);
+            case UploadStrategy::eHost:
+                return Vulkan::AllocateBuffer(
+                    vma::AllocationCreateFlagBits::eMapped |
+                        vma::AllocationCreateFlagBits::eHostAccessRandom,
+                    vma::MemoryUsage::eCpuOnly, {},
+                    size,
+                    usage | vk::BufferUsageFlagBits::eTransferDst);
+        }
+
+        DIGNIS_ASSERT(false, "Unknown Ignis::Render::UploadStrategy.");
+        return Vulkan::Buffer{};
+    }
+
+    TextureAsset::Allocator Render::MakeTextureStagingAllocator(Vulkan::Buffer &staging_buffer, const uint64_t trailing_size) {
+        return [&staging_buffer, trailing_size](const TextureAsset &, const uint64_t size) {
+            // A load that failed after allocating is retried by the caller, the last allocation wins.
+            if (staging_buffer.Handle)
+                Vulkan::DestroyBuffer(staging_buffer);
+
+            // Zstandard reads back the window it already decoded, so cached host memory is preferred over write-combined.
+            staging_buffer = Vulkan::AllocateBuffer(
+                vma::AllocationCreateFlagBits::eMapped |
+                    vma::AllocationCreateFlagBits::eHostAccessRandom,
+                vma::MemoryUsage::eAutoPreferHost, {},
+                size + trailing_size,
+                vk::BufferUsageFlagBits::eTransferSrc);
+
+            return std::span{static_cast<uint8_t *>(Vulkan::GetAllocationInfo(staging_buffer).pMappedData), size};
+        };
+    }
+
+    void Render::uploadToBuffer(
+        const Vulkan::Buffer &buffer,
+        const uint64_t        offset,
+        const void           *data,
+        const uint64_t        size) {
+        if (0 == size)
+            return;
+
+        // Host-visible buffers are staged too, earlier frames may still be reading them and a direct write would tear.
+        const uint64_t staging_offset = m_PendingUploadData.size();
+
+        m_PendingUploadData.resize(staging_offset + size);
+        std::memcpy(m_PendingUploadData.data() + staging_offset, data, size);
+
+        m_PendingUploads.push_back(PendingUpload{buffer.Handle, offset, staging_offset, size});
+    }
+
+    void Render::discardUploads(const vk::Buffer buffer) {
+        std::erase_if(m_PendingUploads, [buffer](const PendingUpload &upload) {
+            return upload.Buffer == buffer;
+        });
+    }
+
+    void Render::recordUploads(FrameGraph &frame_graph) {
+        if (m_PendingUploads.empty()) {
+            m_PendingUploadData.clear();
+            return;
+        }
+
+        Vulkan::Buffer &staging_buffer = m_UploadStagingBuffers[Frame::GetRef().getFrameIndex()];
+
+        // The frame fence has been waited on, so this frame's staging buffer is no longer in use.
+        if (staging_buffer.Size < m_PendingUploadData.size()) {
+            const Vulkan::Buffer old_buffer = staging_buffer;
+
+            staging_buffer = Vulkan::AllocateBuffer(
+                old_buffer.AllocationFlags,
+                old_buffer.MemoryUsage,
+                old_buffer.CreateFlags,
+                std::bit_ceil(m_PendingUploadData.size()),
+                old_buffer.Usage);
+
+            Vulkan::DestroyBuffer(old_buffer);
+        }
+
+        Vulkan::CopyMemoryToAllocation(
+            m_PendingUploadData.data(),
+            staging_buffer.Allocation, 0,
+            m_PendingUploadData.size());
+
+        gtl::flat_hash_map<VkBuffer, std::vector<vk::BufferCopy2>> buffer_regions{};
+
+        for (const auto &[buffer, offset, staging_offset, size] : m_PendingUploads)
+            buffer_regions[buffer].push_back(vk::BufferCopy2{staging_offset, offset, size});
+
+        FrameGraph::ComputePass upload_pass{
+            "Ignis::Render::Upload Pass",
+            {0.0f, 1.0f, 1.0f, 1.0f},
+        };
+
+        for (const VkBuffer buffer : std::views::keys(buffer_regions)) {
+            const FrameGraph::BufferID buffer_id = frame_graph.getBufferID(buffer);
+
+            upload_pass.writeBuffer(FrameGraph::BufferInfo{
+                buffer_id,
+                0,
+                frame_graph.getBufferSize(buffer_id),
+                vk::PipelineStageFlagBits2::eTransfer,
+            });
+        }
+
+        upload_pass.setExecute(
+            [staging_handle = staging_buffer.Handle,
+             buffer_regions = std::move(buffer_regions)](const vk::CommandBuffer command_buffer) {
+                // Earlier frames may still be reading the destinations.
+                Vulkan::BarrierMerger merger{};
+                for (const VkBuffer buffer : std::views::keys(buffer_regions)) {
+                    merger.putBufferBarrier(
+                        buffer, 0, vk::WholeSize,
+                        vk::PipelineStageFlagBits2::eDrawIndirect |
+                            vk::PipelineStageFlagBits2::eVertexShader |
+                            vk::PipelineStageFlagBits2::eFragmentShader |
+                            vk::PipelineStageFlagBits2::eComputeShader,
+                        vk::AccessFlagBits2::eNone,
+                        vk::PipelineStageFlagBits2::eTransfer,
+                        vk::AccessFlagBits2::eTransferWrite);
+                }
+                merger.flushBarriers(command_buffer);
+
+                for (const auto &[buffer, regions] : buffer_regions)
+                    Vulkan::CopyBufferToBuffer(staging_handle, buffer, regions, command_buffer);
+            });
+
+        frame_graph.addComputePass(upload_pass);
+
+        m_PendingUploads.clear();
+        m_PendingUploadData.clear();
+    }
+}  // namespace Ignis
@@ -194,6 +194,23 @@ namespace Ignis {
         return s_pInstance->m_VmaAllocator.getAllocationInfo(buffer.Allocation);
     }
 
+    vk::MemoryPropertyFlags Vulkan::GetAllocationMemoryProperties(const vma::Allocation &allocation) {
+        DIGNIS_ASSERT(nullptr != s_pInstance, "Ignis::Vulkan is not initialized.");
+        return s_pInstance->m_VmaAllocator.getAllocationMemoryProperties(allocation);
+    }
+
+    vma::Budget Vulkan::GetAllocationHeapBudget(const vma::Allocation &allocation) {
+        DIGNIS_ASSERT(nullptr != s_pInstance, "Ignis::Vulkan is not initialized.");
+
+        const vma::AllocationInfo                allocation_info   = s_pInstance->m_VmaAllocator.getAllocationInfo(allocation);
+        const vk::PhysicalDeviceMemoryProperties memory_properties = s_pInstance->m_PhysicalDevice.getMemoryProperties();
+
+        std::array<vma::Budget, VK_MAX_MEMORY_HEAPS> budgets{};
+        s_pInstance->m_VmaAllocator.getHeapBudgets(budgets.data());
+
+        return budgets[memory_properties.memoryTypes[allocation_info.memoryType].heapIndex];
+    }
+
     void Vulkan::initialize(const Settings &settings) {
         DIGNIS_ASSERT(nullptr == s_pInstance, "Ignis::Vulkan is already initialized.");
 
@@ -213,7 +230,7 @@ namespace Ignis {
             instance_layers.push_back("VK_LAYER_KHRONOS_validation");
 #endif
 
-        const std::vector device_extensions{
+        std::vector device_extensions{
             VK_KHR_SWAPCHAIN_EXTENSION_NAME,
         };
 
@@ -278,6 +295,11 @@ namespace Ignis {
         selectSwapchainFormat(settings.PreferredSurfaceFormats);
         selectSwapchainPresentMode(settings.PreferredPresentModes);
 
+        // Real heap budgets let texture residency stay clear of what the rest of the system is using.
+        const bool memory_budget = CheckPhysicalDeviceExtensionSupport(m_PhysicalDevice, VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+        if (memory_budget)
+            device_extensions.push_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+
         m_SwapchainUsageFlags =
             vk::ImageUsageFlagBits::eColorAttachment |
             vk::ImageUsageFlagBits::eTransferSrc |
@@ -289,6 +311,9 @@ namespace Ignis {
 
         vk::PhysicalDeviceRobustness2FeaturesEXT robustness_features{};
 
+        // Block compressed formats are optional, mostly missing on mobile GPUs, the renderer uploads RGBA8 without them.
+        const vk::PhysicalDeviceFeatures supported_features = m_PhysicalDevice.getFeatures();
+
         vk::PhysicalDeviceVulkan13Features vulkan13_features{};
         vk::PhysicalDeviceVulkan12Features vulkan12_features{};
         vk::PhysicalDeviceVulkan11Features vulkan11_features{};
@@ -309,6 +334,7 @@ namespace Ignis {
         vulkan12_features
             .setBufferDeviceAddress(vk::True)
             .setDescriptorIndexing(vk::True)
+            .setDrawIndirectCount(vk::True)
             .setRuntimeDescriptorArray(vk::True)
             .setDescriptorBindingPartiallyBound(vk::True)
             .setDescriptorBindingSampledImageUpdateAfterBind(vk::True)
@@ -330,6 +356,7 @@ namespace Ignis {
                 vk::PhysicalDeviceFeatures()
                     .setFullDrawIndexUint32(vk::True)
                     .setSamplerAnisotropy(vk::True)
+                    .setTextureCompressionBC(supported_features.textureCompressionBC)
                     .setRobustBufferAccess(vk::True)
                     .setMultiDrawIndirect(vk::True))
             .setPNext(&vulkan11_features);
@@ -369,9 +396,13 @@ namespace Ignis {
 
         createSwapchain(width, height);
 
+        vma::AllocatorCreateFlags vma_allocator_flags = vma::AllocatorCreateFlagBits::eBufferDeviceAddress;
+        if (memory_budget)
+            vma_allocator_flags |= vma::AllocatorCreateFlagBits::eExtMemoryBudget;
+
         vma::AllocatorCreateInfo vma_allocator_create_info{};
         vma_allocator_create_info
-            .setFlags(vma::AllocatorCreateFlagBits::eBufferDeviceAddress)
+            .setFlags(vma_allocator_flags)
             .setInstance(m_Instance)
             .setPhysicalDevice(m_PhysicalDevice)
             .setDevice(m_Device)
@@ -478,6 +509,19 @@ namespace Ignis {
         return true;
     }
 
+    bool Vulkan::CheckPhysicalDeviceExtensionSupport(const vk::PhysicalDevice physical_device, const char *extension_name) {
+        auto [result, available_extensions] = physical_device.enumerateDeviceExtensionProperties();
+        IGNIS_VK_CHECK(result);
+
+        for (const auto &extension_property : available_extensions) {
+            if (strcmp(extension_name, extension_property.extensionName.data()) == 0) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
     bool Vulkan::CheckPhysicalDeviceSwapchainSupport(
         const vk::PhysicalDevice physical_device,
         const vk::SurfaceKHR     surface,
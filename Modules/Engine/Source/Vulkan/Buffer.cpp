@@ -41,4 +41,21 @@ namespace Ignis {
 
         return buffer;
     }
+
+    void Vulkan::DestroyVirtualBlock(const vma::VirtualBlock virtual_block) {
+        DIGNIS_ASSERT(nullptr != s_pInstance, "Ignis::Vulkan is not initialized.");
+        virtual_block.clearVirtualBlock();
+        virtual_block.destroy();
+    }
+
+    vma::VirtualBlock Vulkan::CreateVirtualBlock(const uint64_t size) {
+        DIGNIS_ASSERT(nullptr != s_pInstance, "Ignis::Vulkan is not initialized.");
+        vma::VirtualBlockCreateInfo create_info{};
+        create_info.setSize(size);
+
+        auto [result, virtual_block] = vma::createVirtualBlock(create_info);
+        DIGNIS_VK_CHECK(result);
+
+        return virtual_block;
+    }
 }  // namespace Ignis
\ No newline at end of file
@@ -383,6 +383,89 @@ namespace Ignis {
         merger.flushBarriers(command_buffer);
     }
 
+    void Vulkan::GenerateImage2DMipLevels(
+        const vk::Image         image,
+        const vk::ImageLayout   old_layout,
+        const vk::ImageLayout   new_layout,
+        const uint32_t          mip_level_count,
+        const vk::Extent2D     &extent,
+        const vk::CommandBuffer command_buffer) {
+        BarrierMerger merger{};
+        if (vk::ImageLayout::eTransferDstOptimal != old_layout) {
+            merger.putImageBarrier(
+                image,
+                old_layout,
+                vk::ImageLayout::eTransferDstOptimal,
+                0, vk::RemainingMipLevels,
+                0, 1,
+                vk::PipelineStageFlagBits2::eAllCommands,
+                vk::AccessFlagBits2::eTransferRead,
+                vk::PipelineStageFlagBits2::eBlit,
+                vk::AccessFlagBits2::eTransferWrite);
+            merger.flushBarriers(command_buffer);
+        }
+
+        merger.putImageBarrier(
+            image,
+            vk::ImageLayout::eTransferDstOptimal,
+            vk::ImageLayout::eTransferSrcOptimal,
+            0, 1,
+            0, 1,
+            vk::PipelineStageFlagBits2::eAllTransfer,
+            vk::AccessFlagBits2::eTransferWrite,
+            vk::PipelineStageFlagBits2::eBlit,
+            vk::AccessFlagBits2::eTransferRead);
+        merger.flushBarriers(command_buffer);
+
+        vk::Extent3D src_extent{extent, 1};
+        vk::Extent3D dst_extent{extent, 1};
+
+        for (uint32_t mip_level = 1; mip_level < mip_level_count; mip_level++) {
+            // Non-square images keep halving the longer side after the shorter one reaches a single texel.
+            dst_extent.width  = glm::max(dst_extent.width / 2, 1u);
+            dst_extent.height = glm::max(dst_extent.height / 2, 1u);
+            BlitImageToImage(
+                image,
+                image,
+                mip_level - 1,
+                mip_level,
+                0, 0,
+                1, 1,
+                {0, 0, 0},
+                {0, 0, 0},
+                src_extent,
+                dst_extent,
+                command_buffer);
+
+            merger.putImageBarrier(
+                image,
+                vk::ImageLayout::eTransferDstOptimal,
+                vk::ImageLayout::eTransferSrcOptimal,
+                mip_level, 1,
+                0, 1,
+                vk::PipelineStageFlagBits2::eBlit,
+                vk::AccessFlagBits2::eTransferWrite,
+                vk::PipelineStageFlagBits2::eBlit,
+                vk::AccessFlagBits2::eTransferRead);
+            merger.flushBarriers(command_buffer);
+
+            src_extent.width  = dst_extent.width;
+            src_extent.height = dst_extent.height;
+        }
+
+        merger.putImageBarrier(
+            image,
+            vk::ImageLayout::eTransferSrcOptimal,
+            new_layout,
+            0, vk::RemainingMipLevels,
+            0, 1,
+            vk::PipelineStageFlagBits2::eBlit,
+            vk::AccessFlagBits2::eTransferRead,
+            vk::PipelineStageFlagBits2::eAllCommands,
+            vk::AccessFlagBits2::eMemoryRead);
+        merger.flushBarriers(command_buffer);
+    }
+
     void Vulkan::CopyImageToImage(
         const vk::Image         src_image,
         const vk::Image         dst_image,
@@ -419,6 +502,43 @@ namespace Ignis {
         command_buffer.copyImage2(copy_info);
     }
 
+    void Vulkan::CopyImageToImage(
+        const vk::Image         src_image,
+        const vk::Image         dst_image,
+        const uint32_t          src_mip_level,
+        const uint32_t          dst_mip_level,
+        const uint32_t          layer_count,
+        const vk::Extent3D     &extent,
+        const vk::CommandBuffer command_buffer) {
+        vk::ImageCopy2 region{};
+        region
+            .setSrcOffset(vk::Offset3D{0, 0, 0})
+            .setDstOffset(vk::Offset3D{0, 0, 0})
+            .setSrcSubresource(
+                vk::ImageSubresourceLayers{}
+                    .setAspectMask(vk::ImageAspectFlagBits::eColor)
+                    .setBaseArrayLayer(0)
+                    .setLayerCount(layer_count)
+                    .setMipLevel(src_mip_level))
+            .setDstSubresource(
+                vk::ImageSubresourceLayers{}
+                    .setAspectMask(vk::ImageAspectFlagBits::eColor)
+                    .setBaseArrayLayer(0)
+                    .setLayerCount(layer_count)
+                    .setMipLevel(dst_mip_level))
+            .setExtent(extent);
+
+        vk::CopyImageInfo2 copy_info{};
+        copy_info
+            .setSrcImage(src_image)
+            .setDstImage(dst_image)
+            .setSrcImageLayout(vk::ImageLayout::eTransferSrcOptimal)
+            .setDstImageLayout(vk::ImageLayout::eTransferDstOptimal)
+            .setRegions(region);
+
+        command_buffer.copyImage2(copy_info);
+    }
+
     void Vulkan::CopyBufferToBuffer(
         const vk::Buffer        src_buffer,
         const vk::Buffer        dst_buffer,
@@ -439,9 +559,47 @@ namespace Ignis {
         command_buffer.copyBuffer2(copy_info);
     }
 
+    void Vulkan::CopyBufferToBuffer(
+        const vk::Buffer                       src_buffer,
+        const vk::Buffer                       dst_buffer,
+        const vk::ArrayProxy<vk::BufferCopy2> &regions,
+        const vk::CommandBuffer                command_buffer) {
+        vk::CopyBufferInfo2 copy_info{};
+        copy_info
+            .setSrcBuffer(src_buffer)
+            .setDstBuffer(dst_buffer)
+            .setRegions(regions);
+        command_buffer.copyBuffer2(copy_info);
+    }
+
+    void Vulkan::CopyBufferToImage(
+        const vk::Buffer        src_buffer,
+        const vk::Image         dst_image,
+        const uint64_t          src_offset,
+        const vk::Offset3D     &dst_offset,
+        const vk::Extent2D     &src_extent,
+        const vk::Extent3D     &dst_extent,
+        const vk::CommandBuffer command_buffer) {
+        CopyBufferToImage(src_buffer, dst_image, 0, src_offset, dst_offset, src_extent, dst_extent, command_buffer);
+    }
+
+    void Vulkan::CopyBufferToImage(
+        const vk::Buffer        src_buffer,
+        const vk::Image         dst_image,
+        const uint32_t          dst_mip_level,
+        const uint64_t          src_offset,
+        const vk::Offset3D     &dst_offset,
+        const vk::Extent2D     &src_extent,
+        const vk::Extent3D     &dst_extent,
+        const vk::CommandBuffer command_buffer) {
+        CopyBufferToImage(src_buffer, dst_image, dst_mip_level, 1, src_offset, dst_offset, src_extent, dst_extent, command_buffer);
+    }
+
     void Vulkan::CopyBufferToImage(
         const vk::Buffer        src_buffer,
         const vk::Image         dst_image,
+        const uint32_t          dst_mip_level,
+        const uint32_t          dst_layer_count,
         const uint64_t          src_offset,
         const vk::Offset3D     &dst_offset,
         const vk::Extent2D     &src_extent,
@@ -458,8 +616,8 @@ namespace Ignis {
                 vk::ImageSubresourceLayers{}
                     .setAspectMask(vk::ImageAspectFlagBits::eColor)
                     .setBaseArrayLayer(0)
-                    .setLayerCount(1)
-                    .setMipLevel(0));
+                    .setLayerCount(dst_layer_count)
+                    .setMipLevel(dst_mip_level));
 
         vk::CopyBufferToImageInfo2 copy_info{};
         copy_info
@@ -199,6 +199,113 @@ namespace Ignis {
         return image;
     }
 
+    Vulkan::Image Vulkan::AllocateImage2DArray(
+        const vma::AllocationCreateFlags allocation_flags,
+        const vma::MemoryUsage           memory_usage,
+        const vk::ImageCreateFlagBits    image_flags,
+        const vk::Format                 format,
+        const vk::ImageUsageFlags        usage_flags,
+        const uint32_t                   mip_level_count,
+        const uint32_t                   layer_count,
+        const vk::Extent2D              &extent) {
+        DIGNIS_ASSERT(nullptr != s_pInstance, "Ignis::Vulkan is not initialized.");
+        vk::ImageCreateInfo image_create_info{};
+        image_create_info
+            .setFlags(image_flags)
+            .setImageType(vk::ImageType::e2D)
+            .setFormat(format)
+            .setExtent(vk::Extent3D{extent, 1})
+            .setArrayLayers(layer_count)
+            .setMipLevels(mip_level_count)
+            .setSamples(vk::SampleCountFlagBits::e1)
+            .setInitialLayout(vk::ImageLayout::eUndefined)
+            .setTiling(vk::ImageTiling::eOptimal)
+            .setUsage(usage_flags);
+        vma::AllocationCreateInfo create_info{};
+        create_info
+            .setFlags(allocation_flags)
+            .setUsage(memory_usage);
+
+        const auto [result, image_allocation] =
+            s_pInstance->m_VmaAllocator.createImage(image_create_info, create_info);
+        DIGNIS_VK_CHECK(result);
+        const auto [handle, allocation] = image_allocation;
+
+        Image image{};
+        image.Handle        = handle;
+        image.Format        = format;
+        image.Extent        = vk::Extent3D{extent, 1};
+        image.Allocation    = allocation;
+        image.Usage         = usage_flags;
+        image.MipLevelCount = mip_level_count;
+
+        image.CreateFlags = image_flags;
+        image.MemoryUsage = memory_usage;
+
+        image.AllocationFlags = allocation_flags;
+
+        return image;
+    }
+
+    Vulkan::Image Vulkan::AllocateImage2DWithMipLevels(
+        const vma::AllocationCreateFlags allocation_flags,
+        const vma::MemoryUsage           memory_usage,
+        const vk::ImageCreateFlagBits    image_flags,
+        const vk::Format                 format,
+        const vk::ImageUsageFlags        usage_flags,
+        const vk::Extent2D              &extent) {
+        const uint32_t mip_level_count = std::bit_width(glm::max(extent.width, extent.height));
+
+        return AllocateImage2D(allocation_flags, memory_usage, image_flags, format, usage_flags, mip_level_count, extent);
+    }
+
+    Vulkan::Image Vulkan::AllocateImage2D(
+        const vma::AllocationCreateFlags allocation_flags,
+        const vma::MemoryUsage           memory_usage,
+        const vk::ImageCreateFlagBits    image_flags,
+        const vk::Format                 format,
+        const vk::ImageUsageFlags        usage_flags,
+        const uint32_t                   mip_level_count,
+        const vk::Extent2D              &extent) {
+        DIGNIS_ASSERT(nullptr != s_pInstance, "Ignis::Vulkan is not initialized.");
+        vk::ImageCreateInfo image_create_info{};
+        image_create_info
+            .setFlags(image_flags)
+            .setImageType(vk::ImageType::e2D)
+            .setFormat(format)
+            .setExtent(vk::Extent3D{extent, 1})
+            .setArrayLayers(1)
+            .setMipLevels(mip_level_count)
+            .setSamples(vk::SampleCountFlagBits::e1)
+            .setInitialLayout(vk::ImageLayout::eUndefined)
+            .setTiling(vk::ImageTiling::eOptimal)
+            .setUsage(usage_flags);
+        vma::AllocationCreateInfo create_info{};
+        create_info
+            .setFlags(allocation_flags)
+            .setUsage(memory_usage);
+
+        const auto [result, image_allocation] =
+            s_pInstance->m_VmaAllocator.createImage(image_create_info, create_info);
+        DIGNIS_VK_CHECK(result);
+        const auto [handle, allocation] = image_allocation;
+
+        Image image{};
+        image.Handle        = handle;
+        image.Format        = format;
+        image.Extent        = vk::Extent3D{extent, 1};
+        image.Allocation    = allocation;
+        image.Usage         = usage_flags;
+        image.MipLevelCount = mip_level_count;
+
+        image.CreateFlags = image_flags;
+        image.MemoryUsage = memory_usage;
+
+        image.AllocationFlags = allocation_flags;
+
+        return image;
+    }
+
     Vulkan::Image Vulkan::AllocateImage2D(
         const vma::AllocationCreateFlags allocation_flags,
         const vma::MemoryUsage           memory_usage,
@@ -402,6 +509,29 @@ namespace Ignis {
         return view;
     }
 
+    vk::ImageView Vulkan::CreateImageColorView2DWithMipLevels(
+        const vk::Image  image,
+        const vk::Format format,
+        const uint32_t   base_mip_level,
+        const uint32_t   mip_level_count) {
+        DIGNIS_ASSERT(nullptr != s_pInstance, "Ignis::Vulkan is not initialized.");
+        vk::ImageViewCreateInfo create_info{};
+        create_info
+            .setViewType(vk::ImageViewType::e2D)
+            .setFormat(format)
+            .setImage(image)
+            .setSubresourceRange(
+                vk::ImageSubresourceRange{}
+                    .setAspectMask(vk::ImageAspectFlagBits::eColor)
+                    .setBaseArrayLayer(0)
+                    .setBaseMipLevel(base_mip_level)
+                    .setLayerCount(1)
+                    .setLevelCount(mip_level_count));
+        auto [result, view] = s_pInstance->m_Device.createImageView(create_info);
+        DIGNIS_VK_CHECK(result);
+        return view;
+    }
+
     vk::ImageView Vulkan::CreateImageDepthView2D(
         const vk::Image  image,
         const vk::Format format,
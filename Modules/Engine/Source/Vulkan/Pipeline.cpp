@@ -61,6 +61,21 @@ namespace Ignis {
         return *this;
     }
 
+    Vulkan::GraphicsPipelineBuilder &Vulkan::GraphicsPipelineBuilder::setSpecializationConstant(
+        const vk::ShaderStageFlagBits stage,
+        const uint32_t                constant_id,
+        const uint32_t                value) {
+        const auto shader_stage = std::ranges::find(m_ShaderStages, stage, &ShaderStageInfo::Stage);
+        DIGNIS_ASSERT(std::end(m_ShaderStages) != shader_stage, "Specialization constants need their shader stage set first.");
+
+        shader_stage->SpecializationEntries.emplace_back(
+            constant_id,
+            static_cast<uint32_t>(sizeof(uint32_t) * shader_stage->SpecializationData.size()),
+            sizeof(uint32_t));
+        shader_stage->SpecializationData.push_back(value);
+        return *this;
+    }
+
     Vulkan::GraphicsPipelineBuilder &Vulkan::GraphicsPipelineBuilder::setVertexLayouts(const vk::ArrayProxy<VertexLayout> &vertex_layouts) {
         m_VertexInputBindingDescriptions.clear();
         m_VertexInputAttributeDescriptions.clear();
@@ -224,26 +239,43 @@ namespace Ignis {
         dynamic_state_create_info
             .setDynamicStates(dynamic_states);
 
+        // Depth only pipelines have no color attachments, so they get no blend states either.
+        const std::vector<vk::PipelineColorBlendAttachmentState> color_blend_attachments(
+            m_ColorAttachmentFormats.size(),
+            m_ColorBlendAttachment);
+
         vk::PipelineColorBlendStateCreateInfo color_blend_state_create_info{};
         color_blend_state_create_info
             .setLogicOpEnable(vk::False)
             .setLogicOp(vk::LogicOp::eNoOp)
-            .setAttachments(m_ColorBlendAttachment);
+            .setAttachments(color_blend_attachments);
 
         vk::PipelineVertexInputStateCreateInfo vertex_input_state_create_info{};
         vertex_input_state_create_info
             .setVertexBindingDescriptions(m_VertexInputBindingDescriptions)
             .setVertexAttributeDescriptions(m_VertexInputAttributeDescriptions);
 
+        std::vector<vk::SpecializationInfo> specialization_infos{};
+        specialization_infos.reserve(m_ShaderStages.size());
+
         std::vector<vk::PipelineShaderStageCreateInfo> shader_stages{};
         shader_stages.reserve(m_ShaderStages.size());
-        for (const auto &[entry_point, module, stage] : m_ShaderStages) {
+        for (const auto &[entry_point, module, stage, specialization_entries, specialization_data] : m_ShaderStages) {
             vk::PipelineShaderStageCreateInfo shader_stage{};
             shader_stage
                 .setFlags({})
                 .setPName(entry_point.c_str())
                 .setModule(module)
                 .setStage(stage);
+
+            if (!specialization_entries.empty()) {
+                specialization_infos.push_back(
+                    vk::SpecializationInfo{}
+                        .setMapEntries(specialization_entries)
+                        .setData<uint32_t>(specialization_data));
+                shader_stage.setPSpecializationInfo(&specialization_infos.back());
+            }
+
             shader_stages.push_back(shader_stage);
         }
 